@@ -0,0 +1,49 @@
+# Summary of a Projections trace for comparing load balancing steps: for
+# each PE the time it was idle, the time its elements were held at the
+# AtSync barrier, from the start of a load balancing step on the PE to the
+# resumption of its clients, and how much of that the PE sat idle.
+#
+#   zcat dir/stencil3d.prj.*.log.gz | awk -f timeline.awk dir/stencil3d.prj.sts -
+#
+# Times in the logs are in microseconds.
+
+FILENAME != "-" {				# the .sts file
+  if ($1 == "ENTRY" && $2 == "CHARE") {
+    if ($4 == "ProcessAtSync(void)" || $4 == "AsyncAtSync(void)") step_ep[$3] = 1
+    if ($4 ~ /^ResumeClients\(/) resume_ep[$3] = 1
+  }
+  next
+}
+
+$1 == "PROJECTIONS-RECORD" { pe = npes++; held_from = -1 }
+$1 == 6  { start[pe] = $2 }			# BEGIN_COMPUTATION
+$1 == 7  { end[pe] = $2 }			# END_COMPUTATION
+$1 == 14 { idle_from = $2 }			# BEGIN_IDLE
+$1 == 15 {					# END_IDLE
+  idle[pe] += $2 - idle_from
+  if (held_from >= 0)			# counted once the hold ends
+    held_idle_from += $2 - (idle_from > held_from ? idle_from : held_from)
+}
+$1 == 2 {					# BEGIN_PROCESSING
+  if ($3 in step_ep && held_from < 0) {
+    held_from = $4; held_idle_from = 0; steps[pe]++
+  }
+  else if ($3 in resume_ep && held_from >= 0) {
+    held[pe] += $4 - held_from
+    held_idle[pe] += held_idle_from
+    held_from = -1
+  }
+}
+
+END {
+  printf("PE    span(ms)  idle(ms)  LB steps  held(ms)  idle while held(ms)\n")
+  for (p = 0; p < npes; p++) {
+    span = end[p] - start[p]
+    printf("%-4d %9.1f %9.1f %9d %9.1f %9.1f\n", p, span / 1000,
+           idle[p] / 1000, steps[p], held[p] / 1000, held_idle[p] / 1000)
+    tspan += span; tidle += idle[p]; tsteps += steps[p]
+    theld += held[p]; theld_idle += held_idle[p]
+  }
+  printf("all  %9.1f %9.1f %9d %9.1f %9.1f\n", tspan / 1000, tidle / 1000,
+         tsteps, theld / 1000, theld_idle / 1000)
+}
@@ -57,6 +57,11 @@ extern bool _isStaticInsertion;
  */
 extern bool _isNotifyChildInRed;
 
+/** Direct calls to array elements on the same PE (see CkLocalCall) nest
+ *  at most this deep; 0 turns them off.
+ */
+extern int _maxLocalCallDepth;
+
 /**
 \addtogroup CkArray
 \brief Migratable Chare Arrays: user-visible classes.
@@ -406,6 +411,42 @@ public:
 };
 PUPmarshall(CProxyElement_ArrayBase)
 
+/**
+  Calls a marshalled entry method of an array element on this PE as a
+  plain function call, with no message and no trip through the scheduler.
+  The proxy code charmxi generates for an entry method that takes only
+  builtin scalars, and is not threaded, sync or SDAG, begins
+      CkLocalCall impl_call(*this,ep,impl_e_opts);
+      if (impl_call.element()) {
+        ((Foo *)impl_call.element())->bar(x,y);
+        return;
+      }
+  and sends the usual message when element() is NULL: when the element is
+  not here or is already running an entry method (it is the sender, or
+  further up a chain of direct calls), when the call has entry options
+  such as a priority, goes through a delegated proxy or comes from a
+  threaded entry method, when direct calls already nest
+  _maxLocalCallDepth deep (+localCallDepth), or when the scheduler queue
+  holds a message the call's message would not overtake.  An element that
+  migrates or deletes itself during a direct call only leaves once the
+  outermost direct call, or the broadcast being delivered, is done.  The
+  element's load and trace events are recorded as for a delivered
+  message.
+*/
+class CkLocalCall {
+	ArrayElement *elt; //The element to call, or NULL to send a message
+	CkLocRec_local *rec;
+	int ep;
+	bool isDeleted; //Set if the element is deleted during the call
+	int callerStopped; //The caller's load measurement was suspended
+	LDObjHandle callerHandle;
+public:
+	CkLocalCall(const CProxyElement_ArrayBase &proxy,int ep,
+		const CkEntryOptions *opts);
+	~CkLocalCall();
+	inline ArrayElement *element(void) const {return elt;}
+};
+
 class CProxySection_ArrayBase:public CProxy_ArrayBase {
 private:
 	int _nsid;
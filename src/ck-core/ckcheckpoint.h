@@ -26,6 +26,7 @@ restarting of Charm++ programs. ...
 #ifndef _CKCHECKPOINT_H
 #define _CKCHECKPOINT_H
 
+#include <string>
 #include <pup.h>
 #include <ckcallback.h>
 #include <ckmessage.h>
@@ -57,7 +58,64 @@ void CkRemoveArrayElements();
 //void CkTestArrayElements();
 
 void CkStartCheckpoint(const char* dirname,const CkCallback& cb);
+/// Asynchronous checkpoint: cb is sent as soon as every PE has packed its
+/// part of the checkpoint into memory, and writtenCB once all of it is on
+/// disk.  The files are written in the background, between the entry
+/// methods of the application.
+void CkStartCheckpoint(const char* dirname,const CkCallback& cb,const CkCallback& writtenCB);
 void CkRestartMain(const char* dirname, CkArgMsg *args);
+
+/// Name of a checkpoint file: dirname/[part-N/]basename[_id].dat
+std::string CkCheckpointFileName(const char *dirname, const char *basename, int id = -1);
+
+/**
+  Aggregated disk checkpoints (+chkpt_aggregate N).  Instead of the
+  Chares, Groups, NodeGroups and arr files of every PE, the packed data
+  of each PE goes into one of N large files, data_<file>.dat, written in
+  parallel through CkIO.  PE 0 writes index.dat: a CkCheckpointIndexHeader
+  and a CkCheckpointIndexEntry for each PE, giving where its sections are.
+  The RO and MainChares files are written as before.  The writer lives in
+  the CkIO module, which sets _ckCheckpointWriter when it is linked in.
+*/
+enum {
+  CK_CHKPT_CHARES = 0,
+  CK_CHKPT_GROUPS,
+  CK_CHKPT_NODEGROUPS,          // only on rank 0 of each node
+  CK_CHKPT_ARRAYS,
+  CK_CHKPT_SECTIONS
+};
+
+#define CK_CHKPT_INDEX_MAGIC "CKCHKIDX"
+
+/// Start of RO.dat: the layout of the array elements in the checkpoint,
+/// each a seek block whose section table gives its length, changed with
+/// version 1; version 2 follows it with whether the checkpoint is
+/// aggregated.  A restart of another version aborts.
+#define CK_CHKPT_MAGIC   "CKCHKPT"
+#define CK_CHKPT_VERSION 2
+
+typedef struct {
+  char magic[8];
+  int  numPes;
+  int  numFiles;
+} CkCheckpointIndexHeader;
+
+typedef struct {
+  int  pe, node;
+  int  file;                            // data_<file>.dat
+  CmiInt8 offset;                       // of the first section in the file
+  int  rawLen[CK_CHKPT_SECTIONS];       // packed bytes, 0 if there is none
+  int  len[CK_CHKPT_SECTIONS];          // bytes in the file, less if compressed
+} CkCheckpointIndexEntry;
+PUPbytes(CkCheckpointIndexEntry)
+
+/// Write data, the sections described by entry, into the aggregated
+/// checkpoint in dirname; called on every PE, which gives up data
+/// (allocated with new[]).  done is sent once all of it is on disk.
+typedef void (*CkCheckpointWriterFn)(const char *dirname, char *data,
+                                     const CkCheckpointIndexEntry &entry,
+                                     const CkCallback &done);
+extern CkCheckpointWriterFn _ckCheckpointWriter;
 #if __FAULT__
 int  CkCountArrayElements();
 #endif
@@ -67,5 +125,28 @@ extern int _inrestart;           // 1: if is during restart process
 extern int _restarted;           // 1: if this run is after restart
 extern int _oldNumPes;           // number of processors in the last run
 extern int _chareRestored;       // 1: if chare is restored at restart
+extern int _chkptCompress;       // codec of the checkpoint files, see pup_compress.h
+extern int _chkptAggregate;      // number of files of aggregated checkpoints, 0: one per PE
+extern int _chkptAggregateWriters; // PEs writing aggregated checkpoints
+extern int _restartPlace;        // placement of array elements on restart onto a different number of PEs
+
+/**
+  Restart onto a different number of PEs (+restart_place block|hash|modulo).
+  The array elements of the old PEs are read in parallel, those of old
+  PE j by new PE j*newPes/oldPes, and copied without being unpacked into
+  one bulk message per new PE that gets any, which inserts them; a count
+  reduction tells each new PE how many messages to wait for.  Block
+  placement keeps the order of the old PEs, merging or splitting their
+  elements; hash placement spreads the elements by their index.  Modulo
+  placement is the earlier scheme, kept for comparison: new PE i unpacks
+  the elements of old PEs i, i+newPes, ... itself.
+*/
+enum {
+  CK_RESTART_PLACE_BLOCK = 0,
+  CK_RESTART_PLACE_HASH,
+  CK_RESTART_PLACE_MODULO
+};
+
+void CkRegisterRestartHandlers(void);
 
 #endif //_CKCHECKPOINT_H
@@ -29,6 +29,15 @@ public:
 //#if CMK_LBDB_ON
 #include "LBDatabase.h"
 #include "MetaBalancer.h"
+class CkLocRec;
+#if CMK_FLAT_HASHTABLE
+#include "ckflathashtable.h"
+typedef CkFlatHashtableT<CkArrayIndex,CkLocRec *> CkLocRecHashtable;
+typedef CkFlatHashtableIterator CkLocRecHashIterator;
+#else
+typedef CkHashtableT<CkArrayIndex,CkLocRec *> CkLocRecHashtable;
+typedef CkHashtableIterator CkLocRecHashIterator;
+#endif
 class LBDatabase;
 //#endif
 
@@ -490,7 +499,7 @@ public:
 	CProxy_CkLocMgr thisProxy;
 	CProxyElement_CkLocMgr thislocalproxy;
 	/// The core of the location manager: map array index to element representative
-	CkHashtableT<CkArrayIndex,CkLocRec *> hash;
+	CkLocRecHashtable hash;
 	CmiImmediateLockType hashImmLock;
 
 	/// This flag is set while we delete an old copy of a migrator
@@ -55,7 +55,10 @@ class CkLocRec_local : public CkLocRec {
   CkArrayIndex idx;/// Element's array index
   int localIdx; /// Local index (into array manager's element lists)
   bool running; /// True when inside a startTiming/stopTiming pair
+  int entryDepth; /// Entry methods of this element now on the call stack
   bool *deletedMarker; /// Set this if we're deleted during processing
+  bool inLocalCall; /// Running an entry method called by CkLocalCall
+  int leaving; /// PE to migrate to, or leavingDeleted, once direct calls end
   CkQ<CkArrayMessage *> halfCreated; /// Stores messages for nonexistent siblings of existing elements
 public:
   //Creation and Destruction:
@@ -83,6 +86,23 @@ public:
    */
   bool invokeEntry(CkMigratable *obj,void *msg,int idx,bool doFree);
 
+  /** Bracket a direct call of one of this element's entry methods,
+   *   made by CkLocalCall rather than through a message.  startLocalCall
+   *   returns false, and does nothing, if an entry method of this element
+   *   is already running or it is leaving.  isDeleted is set if the
+   *   element is deleted.  An element that migrates or deletes itself
+   *   during a direct call is only marked as leaving; CkLocalCall calls
+   *   leave() once the outermost direct call has returned.
+   */
+  bool startLocalCall(bool *isDeleted);
+  void endLocalCall(bool *isDeleted);
+  enum {notLeaving=-1, leavingDeleted=-2};
+  inline bool isLeaving(void) const {return leaving!=notLeaving;}
+  void leave(void);
+  /// The same bookkeeping, for the proxies of [local] entry methods
+  inline void enterLocalEntry(void) {entryDepth++;}
+  inline void leaveLocalEntry(void) {entryDepth--;}
+
   virtual RecType type(void);
   virtual bool isObsolete(int nSprings,const CkArrayIndex &idx);
 
@@ -93,6 +113,9 @@ public:
   void setObjTime(double cputime);
   double getObjTime();
   void *getObjUserData(int idx);
+  void addLoadSample(double load);
+  void getLoadTrend(LDLoadTrend &t);
+  void setLoadTrend(const LDLoadTrend &t);
 #else
   inline void startTiming(int ignore_running=0) {  }
   inline void stopTiming(int ignore_running=0) { }
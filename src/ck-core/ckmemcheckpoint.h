@@ -9,6 +9,9 @@ public:
   CkArrayCheckPTReqMessage()  {}
 };
 
+/// size of the blocks incremental checkpoints compare and send
+#define CK_CHKPT_BLOCK  4096
+
 class CkArrayCheckPTMessage: public CMessage_CkArrayCheckPTMessage {
 public:
 	CkArrayID  aid;
@@ -18,6 +21,9 @@ public:
 	int bud1, bud2;
 	int len;
 	int cp_flag;          // 1: from checkpoint 0: from recover
+	int fullLen;          // 0: packData is the image, else changed blocks of an image this long
+	int rawLen;           // 0: packData is as above, else compressed from this many bytes
+	CkArrayCheckPTMessage(): fullLen(0), rawLen(0) {}
 };
 
 
@@ -149,7 +155,7 @@ public:
   void recvData(CkArrayCheckPTMessage *);
   void gotData();
   void recvProcData(CkProcCheckPTMessage *);
-  void cpFinish();
+  void cpFinish(double sentBytes, double fullBytes, double compressBytes, double compressTime);
   void syncFiles(CkReductionMsg *);
   void report();
   void recoverBuddies();
@@ -166,6 +172,10 @@ public:
   void pupAllElements(PUP::er &p);
   void startArrayCheckpoint();
   void recvArrayCheckpoint(CkArrayCheckPTMessage *m);
+  CkArrayCheckPTMessage * makeIncrement(CkArrayCheckPTMessage *msg);
+  CkArrayCheckPTMessage * applyIncrement(CkCheckPTEntry &entry, CkArrayCheckPTMessage *inc);
+  CkArrayCheckPTMessage * compressMsg(CkArrayCheckPTMessage *msg);
+  CkArrayCheckPTMessage * decompressMsg(CkArrayCheckPTMessage *msg);
   void recoverAll(CkArrayCheckPTMessage * msg, CkVec<CkGroupID> * gmap=NULL, CkVec<CkArrayIndex> * imap=NULL);
 public:
   static CkCallback  cpCallback;
@@ -180,6 +190,12 @@ private:
   CkCheckPTEntry chkpTable[2];
 
   int recvCount, peCount;
+    /// bytes of array data sent to the buddy, and the size of the images, since the last contribution
+  double sentBytes, fullBytes;
+    /// +chkpt_compress: bytes given to the codec, and seconds spent on them
+  double compressBytes, compressTime;
+    /// incremental checkpoints: hash of each block of the image the buddy has, empty if it has none
+  CkVec<CmiUInt8> blockHash;
   int expectCount, ackCount;
     /// the processor who initiate the checkpointing
   int cpStarter;
@@ -196,6 +212,7 @@ private:
   int  totalFailed();
 
   void sendProcData();
+  void contributeFinish(int pe);
 };
 
 // called in initCharm
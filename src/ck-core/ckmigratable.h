@@ -2,6 +2,7 @@
 #define CKMIGRATABLE_H
 
 class CkMigratable : public Chare {
+  friend class CkLocalCall;
 protected:
   CkLocRec_local *myRec;
 private:
@@ -90,9 +91,12 @@ public:
 #if CMK_LBDB_ON  //For load balancing:
   void AtSync(int waitForMigration=1);
   int MigrateToPe()  { return myRec->MigrateToPe(); }
+  // barrier periods passed, only counted under asynchronous load balancing
+  int ckBarrierEpoch();
 
 private: //Load balancer state:
   LDBarrierClient ldBarrierHandle;//Transient (not migrated)  
+  int barrierEpoch;//Barrier periods passed, from +LBAsync migration
   LDBarrierReceiver ldBarrierRecvHandle;//Transient (not migrated)  
   static void staticResumeFromSync(void* data);
 public:
@@ -0,0 +1,72 @@
+/*
+Sending large array parameters without copying them.
+
+An array parameter declared "nocopy" in the .ci file, like
+    entry void recv(int n, nocopy double data[n]);
+is passed to the proxy as a CkNcpyBuffer, made by CkSendBuffer:
+    proxy[i].recv(n, CkSendBuffer(data, cb));
+The message then carries this descriptor instead of the data when the
+receiver shares the sender's address space (the whole run is one
+process, as with multicore or a single SMP node), and the entry method
+reads the array straight out of the sender's buffer.  Otherwise the
+array is copied into the message, as for any marshalled array.
+
+Either way, the callback gets a CkDataMsg (see ckcallback-ccs.h) holding
+the buffer's address once the buffer may be reused: after the receiving
+entry method returns, or right after the copy.  Until then the sender
+must not modify or free the buffer, and the receiver must not write to
+it.  Broadcasts and constructor calls always copy.
+
+A "nocopypost" array is sent the same way, but the receiving object
+first says where the array should land.  Before the entry method runs,
+it calls an overload of it that takes the array as a pointer reference
+and a trailing CkNcpyPost:
+    entry void recv(int n, nocopypost double data[n]);
+    void recv(int n, double *&data, CkNcpyPost) { data = ghost; }
+The array is copied straight from the sender's buffer (or from the
+message, when it had to be copied into one) to that address, the
+sender's callback is sent, and the entry method is then called with
+data pointing there.  Leaving the pointer NULL reads the array in place,
+as for nocopy.
+*/
+#ifndef _CKNOCOPY_H_
+#define _CKNOCOPY_H_
+
+#include "ckcallback.h"
+
+class CkNcpyBuffer {
+public:
+	const void *ptr; //The sender's buffer
+	CkCallback cb; //Told when ptr may be reused
+	int byReference; //The data stays in ptr, rather than in the message
+
+	CkNcpyBuffer() :ptr(NULL), byReference(0) {}
+	CkNcpyBuffer(const void *ptr_,const CkCallback &cb_)
+		:ptr(ptr_), cb(cb_), byReference(0) {}
+
+	/// Can a message for one object refer to the sender's memory?
+	static int canReference(void) {return CkNumNodes()==1;}
+
+	/// The sender's buffer is no longer needed: send the callback.
+	void release(void) const {
+		if (!cb.isInvalid()) cb.send(sizeof(ptr),&ptr);
+	}
+
+	void pup(PUP::er &p) {
+		p((char *)&ptr,sizeof(ptr));
+		p|cb;
+		p|byReference;
+	}
+};
+
+/// Marks the overload of an entry method that places nocopypost arrays.
+class CkNcpyPost {};
+
+/// Pass this buffer to a nocopy parameter; cb is sent once it may be reused.
+inline CkNcpyBuffer CkSendBuffer(const void *ptr,
+	const CkCallback &cb=CkCallback(CkCallback::ignore))
+{
+	return CkNcpyBuffer(ptr,cb);
+}
+
+#endif
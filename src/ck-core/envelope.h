@@ -95,6 +95,42 @@ typedef unsigned int   UInt;
 typedef unsigned short UShort;
 typedef unsigned char  UChar;
 
+#if CMK_AUTOPERF_CRITICAL_PATH
+#define CK_PATH_TOKEN_EPS  4
+
+/** The compact critical path token tracemode autoPerf keeps on every
+    message (--enable-autoperf-critical-path): how much entry method
+    execution, in seconds, the longest chain of executions leading to the
+    send took, the autoPerf step it belongs to, and the few entry methods
+    that took the largest share of it.
+*/
+class CkPathToken {
+ public:
+  double length;
+  int    step;                     ///< -1 if the message carries no path
+  UShort ep[CK_PATH_TOKEN_EPS];
+  float  epTime[CK_PATH_TOKEN_EPS];   ///< 0 for an unused slot
+
+  void reset() {
+    length = 0.0;
+    step = -1;
+    for (int i=0; i<CK_PATH_TOKEN_EPS; i++) { ep[i] = 0; epTime[i] = 0.0f; }
+  }
+  /// Extend the path by t seconds of entry method e.  Only the entry
+  /// methods with the largest shares keep a slot, so the shares are
+  /// approximate once more than CK_PATH_TOKEN_EPS of them take turns.
+  void add(int e, double t) {
+    int slot = 0;
+    length += t;
+    for (int i=0; i<CK_PATH_TOKEN_EPS; i++) {
+      if (epTime[i] > 0.0f && ep[i] == e) { epTime[i] += t; return; }
+      if (epTime[i] < epTime[slot]) slot = i;
+    }
+    if (t > epTime[slot]) { ep[slot] = e; epTime[slot] = t; }
+  }
+};
+#endif
+
 #include "charm.h" // for CkGroupID, and CkEnvelopeType
 #if (defined(_FAULT_MLOG_) || defined(_FAULT_CAUSAL_))
 #include "ckobjid.h" //for the ckobjId
@@ -106,6 +142,85 @@ typedef unsigned char  UChar;
 
 CkpvExtern(int, envelopeEventID);
 
+/**
+  Per-PE free lists of small message blocks.
+
+  Messages of up to 2KB (reduction contributions, QD, load balancer and
+  location traffic, small marshalled calls) are allocated with their size
+  rounded up to a power of two, starting at 256 bytes.  CkFreeMsg keeps
+  such a block on the freeing PE's list for that size, and the next
+  message of that size reuses it instead of calling CmiAlloc.  Each list
+  holds at most maxBlocks blocks (the +msgFreeList option).
+
+  Messages are often allocated on one PE and freed on another (a
+  reduction's contributions are freed where they are combined), so the
+  PEs of an SMP node also share a pool: a full list moves half its blocks
+  there, and an empty list takes blocks back from it.  Beyond that,
+  blocks go back to CmiFree.
+*/
+#define CK_MSG_FREELIST_CLASSES 4
+#define CK_MSG_FREELIST_MINSHIFT 8
+
+class CkMsgFreeList {
+  private:
+    int maxBlocks;
+    int num[CK_MSG_FREELIST_CLASSES];
+    void **blocks[CK_MSG_FREELIST_CLASSES];
+    CkMsgFreeList *shared; // this node's pool, or NULL
+    CmiNodeLock lock;      // only used in the node's pool
+
+    bool refill(int c);
+    bool spill(int c);
+  public:
+    UInt nReused;    // small messages taken from a free list
+    UInt nAllocated; // small messages that had to call CmiAlloc
+    UInt nReleased;  // small messages freed when the lists were full
+
+    static int sizeClass(int size) {
+      int c=0;
+      size=(size-1)>>CK_MSG_FREELIST_MINSHIFT;
+      while (size) { c++; size>>=1; }
+      return c;
+    }
+    static int classBytes(int c) { return 1<<(c+CK_MSG_FREELIST_MINSHIFT); }
+
+    CkMsgFreeList(int maxBlocks_, CkMsgFreeList *shared_=NULL);
+
+    void *get(int size) {
+      int c=sizeClass(size);
+      if (c>=CK_MSG_FREELIST_CLASSES) return CmiAlloc(size);
+      /* not safe from an immediate handler, which may interrupt us */
+      if (CmiImmIsRunning()) return CmiAlloc(classBytes(c));
+      if (num[c] || refill(c)) { nReused++; return blocks[c][--num[c]]; }
+      nAllocated++;
+      return CmiAlloc(classBytes(c));
+    }
+    /// Keep a CmiAlloc'd block for reuse; returns false if the caller
+    /// must CmiFree it instead.
+    bool put(void *blk) {
+      int size=SIZEFIELD(blk);
+      int c=sizeClass(size);
+      if (c>=CK_MSG_FREELIST_CLASSES || size!=classBytes(c)) return false;
+      /* someone else holds a reference, or blk is part of a larger block */
+      if (REFFIELD(blk)!=1 || CmiImmIsRunning()) return false;
+      if (num[c]==maxBlocks && !spill(c)) { nReleased++; return false; }
+      blocks[c][num[c]++]=blk;
+      return true;
+    }
+};
+
+CkpvExtern(CkMsgFreeList*, _msgFreeList);
+
+inline void *_allocEnvBlock(int size) {
+  CkMsgFreeList *fl=CkpvAccess(_msgFreeList);
+  return fl ? fl->get(size) : CmiAlloc(size);
+}
+
+inline void _freeEnvBlock(void *blk) {
+  CkMsgFreeList *fl=CkpvAccess(_msgFreeList);
+  if (fl==NULL || !fl->put(blk)) CmiFree(blk);
+}
+
 struct s_objid_o {
   ck::ObjID id;              /// <ck::ObjID if it could be in a union
 #if CMK_SMP_TRACE_COMMTHREAD
@@ -321,7 +436,7 @@ public:
       register UInt tsize = sizeof(envelope)+ 
             CkMsgAlignLength(size)+
 	    sizeof(int)*CkPriobitsToInts(prio);
-      register envelope *env = (envelope *)CmiAlloc(tsize);
+      register envelope *env = (envelope *)_allocEnvBlock(tsize);
 #if CMK_REPLAYSYSTEM
       //for record-replay
       memset(env, 0, sizeof(envelope));
@@ -339,6 +454,9 @@ public:
 #ifdef USE_CRITICAL_PATH_HEADER_ARRAY
       env->pathHistory.reset();
 #endif
+#if CMK_AUTOPERF_CRITICAL_PATH
+      env->pathToken.reset();
+#endif
 
 #if (defined(_FAULT_MLOG_) || defined(_FAULT_CAUSAL_))
       env->sender.type = TypeInvalid;
@@ -476,6 +594,12 @@ public:
     PathHistoryEnvelope pathHistory;
 #endif
 
+#if CMK_AUTOPERF_CRITICAL_PATH
+ public:
+    /// The critical path autoPerf carries, see CkPathToken
+    CkPathToken pathToken;
+#endif
+
 };
 
 
@@ -15,6 +15,9 @@ class Stats {
     UInt nodeGroupInitsProcessed; // # of node group inits processed
     UInt nodeGroupMsgsCreated; // # of for nodegroup msgs created
     UInt nodeGroupMsgsProcessed; // # of for nodegroup msgs processed
+    UInt smallMsgsReused; // # of small msgs taken from a free list
+    UInt smallMsgsAllocated; // # of small msgs allocated with CmiAlloc
+    UInt smallMsgsReleased; // # of small msgs freed with a full free list
   public:
     void *operator new(size_t size) { return _allocMsg(StatMsg, size); }
     void operator delete(void *ptr) { CkFreeMsg(ptr); }
@@ -31,6 +34,9 @@ class Stats {
       nodeGroupInitsProcessed = 0; 
       nodeGroupMsgsCreated = 0; 
       nodeGroupMsgsProcessed = 0; 
+      smallMsgsReused = 0;
+      smallMsgsAllocated = 0;
+      smallMsgsReleased = 0;
     }
     void combine(const Stats* const other) {
       charesCreated += other->charesCreated; 
@@ -45,6 +51,9 @@ class Stats {
       nodeGroupInitsProcessed += other->nodeGroupInitsProcessed; 
       nodeGroupMsgsCreated += other->nodeGroupMsgsCreated; 
       nodeGroupMsgsProcessed += other->nodeGroupMsgsProcessed; 
+      smallMsgsReused += other->smallMsgsReused;
+      smallMsgsAllocated += other->smallMsgsAllocated;
+      smallMsgsReleased += other->smallMsgsReleased;
     }
     void recordCreateChare(int x=1) { charesCreated += x; }
     void recordProcessChare(int x=1) { charesProcessed += x; }
@@ -58,6 +67,11 @@ class Stats {
     void recordProcessNodeGroup(int x=1) { nodeGroupInitsProcessed += x; }
     void recordSendNodeBranch(int x=1) { nodeGroupMsgsCreated += x; }
     void recordProcessNodeBranch(int x=1) { nodeGroupMsgsProcessed += x; }
+    void recordSmallMsgs(UInt reused, UInt allocated, UInt released) {
+      smallMsgsReused = reused;
+      smallMsgsAllocated = allocated;
+      smallMsgsReleased = released;
+    }
     UInt getCharesCreated(void) const { return charesCreated; }
     UInt getCharesProcessed(void) const { return charesProcessed; }
     UInt getForCharesCreated(void) const { return forCharesCreated; }
@@ -70,6 +84,9 @@ class Stats {
     UInt getNodeGroupsProcessed(void) const { return nodeGroupInitsProcessed; }
     UInt getNodeGroupMsgsCreated(void) const { return nodeGroupMsgsCreated; }
     UInt getNodeGroupMsgsProcessed(void) const {return nodeGroupMsgsProcessed;}
+    UInt getSmallMsgsReused(void) const { return smallMsgsReused; }
+    UInt getSmallMsgsAllocated(void) const { return smallMsgsAllocated; }
+    UInt getSmallMsgsReleased(void) const { return smallMsgsReleased; }
 };
 
 CkpvExtern(Stats*, _myStats);
@@ -7,6 +7,27 @@
 #define BASELB_H
 
 #include "LBDatabase.h"
+#if CMK_FLAT_HASHTABLE
+#include "ckflathashtable.h"
+
+/// An object's LDObjKey, as a CkFlatHashtableT key
+class LDObjKeyHash {
+  LDObjKey key;
+public:
+  LDObjKeyHash() {}
+  LDObjKeyHash(const LDObjid &oid, const LDOMid &mid) {
+    key.objID() = oid;
+    key.omID() = mid;
+  }
+  inline CkHashCode hash(void) const {
+    const int *id = key.objID().id;
+    CkHashCode h = key.omID().id.idx;
+    for (int i=0; i<OBJ_ID_SZ; i++) h = circleShift(h, 11) ^ id[i];
+    return h;
+  }
+  inline int compare(const LDObjKeyHash &k) const { return key == k.key; }
+};
+#endif
 
 #define PER_MESSAGE_SEND_OVERHEAD_DEFAULT   3.5e-5
 #define PER_BYTE_SEND_OVERHEAD_DEFAULT      8.5e-9
@@ -103,6 +124,10 @@ double idleTime;
     int *objHash;		// this a map from the hash for the 4 integer
 				// LDObjId to the index in the vector "objData"
     int  hashSize;
+#if CMK_FLAT_HASHTABLE
+    /// replaces objHash: maps each object to 1 + its index in "objData"
+    CkFlatHashtableT<LDObjKeyHash,int> *objTable;
+#endif
 
     int complete_flag;		// if this ocg is complete, eg in HybridLB,
     // this LDStats may not be complete
@@ -96,6 +96,7 @@ double getIdleTime(int);
   void AtSync(void); // Everything is at the PE barrier
   void ProcessAtSync(void); // Receive a message from AtSync to avoid
                             // making projections output look funny
+  void AsyncAtSync(void);   // +LBAsync: send stats, resume clients at once
   void SendStats();
   void ReceiveCounts(CkReductionMsg *);
   void ReceiveStats(CkMarshalledCLBStatsMessage &msg);	// Receive stats on PE 0
@@ -134,6 +135,7 @@ double getIdleTime(int);
 
   void MigrationDone(int balancing);  // Call when migration is complete
   void CheckMigrationComplete();      // Call when all migration is complete
+  void AsyncMigrationDone();          // +LBAsync step has been applied
 
   // IMPLEMENTATION FOR FUTURE PREDICTOR
   void FuturePredictor(LDStats* stats);
@@ -227,6 +229,7 @@ double getIdleTime(int);
 
   void readStatsMsgs(const char* filename);
   void writeStatsMsgs(const char* filename);
+  static int readStatsFile(const char* filename, LDStats *stats);
 
   void preprocess(LDStats* stats);
   virtual LBMigrateMsg* Strategy(LDStats* stats);
@@ -268,6 +271,9 @@ private:
   LBScatterMsg   *storedScatterMsg;
   int  reduction_started;
   int  use_thread;
+  int  async_pending;		// +LBAsync step in progress on this PE
+  int  async_held;		// clients wait for it at the barrier
+  int  async_step;		// step whose statistics it balances
 
   FutureModel *predicted_model;
 
@@ -0,0 +1,56 @@
+/**
+ * \addtogroup CkLdb
+*/
+/*@{*/
+
+#ifndef _CLUSTERTOPOLB_H_
+#define _CLUSTERTOPOLB_H_
+
+#include <vector>
+#include "CentralLB.h"
+#include "ClusterTopoLB.decl.h"
+
+void CreateClusterTopoLB();
+BaseLB * AllocateClusterTopoLB();
+
+/**
+ * Topology-aware balancer for commodity clusters.  The machine is seen as
+ * the hierarchy PE < process < physical node < rack, where racks come from
+ * an optional +LBRackMap file.  Objects are first balanced greedily into one
+ * group per PE, keeping communicating objects together where the load allows,
+ * then the groups are mapped onto PEs so that heavily communicating groups
+ * share a process or node before a rack.
+ */
+class ClusterTopoLB : public CentralLB {
+public:
+  ClusterTopoLB(const CkLBOptions &);
+  ClusterTopoLB(CkMigrateMessage *m):CentralLB(m) { lbname = "ClusterTopoLB"; }
+  void work(LDStats* stats);
+private:
+  // hops between two PEs at each level of the hierarchy
+  enum { SAME_PE = 0, SAME_PROC = 1, SAME_NODE = 2, SAME_RACK = 3, OFF_RACK = 4 };
+
+  struct PeLevel {
+    int pe;
+    int proc;		// SMP process (logical node)
+    int node;		// physical node
+    int rack;
+  };
+  struct GroupEdge {
+    int group;
+    double bytes;
+    GroupEdge(int g, double b): group(g), bytes(b) {}
+  };
+
+  std::vector<int> rackOf;	// physical node -> rack, from the rack map file
+  bool rackMapRead;
+
+  bool QueryBalanceNow(int step);
+  void readRackMap(const char *filename);
+  void buildLevels(BaseLB::LDStats *stats, std::vector<PeLevel> &levels);
+  int  hops(const PeLevel &a, const PeLevel &b);
+};
+
+#endif /* _CLUSTERTOPOLB_H_ */
+
+/*@}*/
@@ -23,6 +23,7 @@ friend class LBDB;
 public:
   LocalBarrier() { cur_refcount = 1; client_count = 0;
                    max_receiver= 0; at_count = 0; on = false; 
+                   epochs = false; period = 0;
 	#if CMK_BIGSIM_CHARM
 	first_free_client_slot = 0;
 	#endif
@@ -39,6 +40,9 @@ public:
   void DecreaseBarrier(LDBarrierClient h, int c);
   void TurnOn() { on = true; CheckBarrier(); };
   void TurnOff() { on = false; };
+  void UseEpochs(bool use);
+  int ClientEpoch(LDBarrierClient h);
+  void SetClientEpoch(LDBarrierClient h, int epoch);
 
 private:
   void CallReceivers(void);
@@ -53,6 +57,8 @@ private:
   int max_receiver;
   int at_count;
   bool on;
+  bool epochs;			// release by client epochs, see CheckBarrier
+  int period;			// releases so far, in client epochs
 
   #if CMK_BIGSIM_CHARM
   int first_free_client_slot;
@@ -122,6 +128,7 @@ public:
   void MulticastSend(const LDOMHandle &destOM, LDObjid *destids, int ndests, unsigned int bytes, int nMsgs);
   int ObjDataCount();
   void GetObjData(LDObjData *data);
+  LBRealType TotalLoadTrend();
   inline int CommDataCount() { 
     if (commTable)
       return commTable->CommCount();
@@ -200,6 +207,12 @@ public:
        { if (useBarrier) localBarrier.DecreaseBarrier(h, c); };
   inline void ResumeClients() 
        { localBarrier.ResumeClients(); };
+  inline void LocalBarrierEpochs(bool use)
+       { localBarrier.UseEpochs(use); };
+  inline int LocalBarrierEpoch(LDBarrierClient h)
+       { return localBarrier.ClientEpoch(h); };
+  inline void SetLocalBarrierEpoch(LDBarrierClient h, int epoch)
+       { localBarrier.SetClientEpoch(h, epoch); };
   inline void MeasuredObjTime(double wtime, double ctime) {
     if (statsAreOn) {
       obj_walltime += wtime;
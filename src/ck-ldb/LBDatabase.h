@@ -28,8 +28,10 @@ private:
   int _lb_ignoreBgLoad;
   int _lb_migObjOnly;		// only consider migratable objs
   int _lb_syncResume;
+  int _lb_async;		// overlap load balancing with computation
   int _lb_samePeSpeed;		// ignore cpu speed
   int _lb_testPeSpeed;		// test cpu speed
+  int _lb_destPeSpeed;		// scale work to the speed of the cpu it lands on
   int _lb_useCpuTime;           // use cpu instead of wallclock time
   int _lb_statson;		// stats collection
   int _lb_traceComm;		// stats collection for comm
@@ -37,6 +39,10 @@ private:
   int _lb_percentMovesAllowed; //Specifies restriction on num of chares to be moved(as a percentage of total number of chares). Used by RefineKLB
   int _lb_teamSize;		// specifies the team size for TeamLB
   int _lb_metaLbOn;
+  char *_lb_rackmap;		// physical node to rack map for ClusterTopoLB
+  int _lb_predictObjLoad;	// per-object load trend prediction
+  double _lb_objload_alpha;	// smoothing of the object load level
+  double _lb_objload_beta;	// smoothing of the object load trend
 public:
   CkLBArgs() {
 #if CMK_BIGSIM_CHARM
@@ -45,6 +51,8 @@ public:
     _autoLbPeriod = 0.5;	// 0.5 second default
 #endif
     _lb_debug = _lb_ignoreBgLoad = _lb_syncResume = _lb_useCpuTime = 0;
+    _lb_async = 0;
+    _lb_destPeSpeed = 0;
     _lb_printsumamry = _lb_migObjOnly = 0;
     _lb_statson = _lb_traceComm = 1;
     _lb_percentMovesAllowed=100;
@@ -52,6 +60,10 @@ public:
     _lb_central_pe = 0;
     _lb_teamSize = 1;
     _lb_metaLbOn = 0;
+    _lb_rackmap = NULL;
+    _lb_predictObjLoad = 0;
+    _lb_objload_alpha = 0.5;
+    _lb_objload_beta = 0.3;
   }
   inline double & lbperiod() { return _autoLbPeriod; }
   inline int & debug() { return _lb_debug; }
@@ -62,8 +74,10 @@ public:
   inline int & ignoreBgLoad() { return _lb_ignoreBgLoad; }
   inline int & migObjOnly() { return _lb_migObjOnly; }
   inline int & syncResume() { return _lb_syncResume; }
+  inline int & asyncLB() { return _lb_async; }
   inline int & samePeSpeed() { return _lb_samePeSpeed; }
   inline int & testPeSpeed() { return _lb_testPeSpeed; }
+  inline int & destPeSpeed() { return _lb_destPeSpeed; }
   inline int & useCpuTime() { return _lb_useCpuTime; }
   inline int & statsOn() { return _lb_statson; }
   inline int & traceComm() { return _lb_traceComm; }
@@ -72,6 +86,10 @@ public:
   inline double & beta() { return _lb_beta; }
   inline int & percentMovesAllowed() { return _lb_percentMovesAllowed;}
   inline int & metaLbOn() {return _lb_metaLbOn;}
+  inline char *& rackMap() { return _lb_rackmap; }
+  inline int & predictObjLoad() { return _lb_predictObjLoad; }
+  inline double & objLoadAlpha() { return _lb_objload_alpha; }
+  inline double & objLoadBeta() { return _lb_objload_beta; }
 };
 
 extern CkLBArgs _lb_args;
@@ -114,6 +132,8 @@ typedef BaseLB * (*LBAllocFn)();
 void LBDefaultCreate(LBCreateFn f);
 
 void LBRegisterBalancer(const char *, LBCreateFn, LBAllocFn, const char *, int shown=1);
+LBAllocFn getLBAllocFn(const char *lbname);
+void LBGetBalancerNames(CkVec<const char *> &names);
 
 void _LBDBInit();
 
@@ -230,6 +250,20 @@ public:
     LDQueryKnownObjLoad(h,&walltime,&cputime);
   };
 
+  inline void ObjLoadSample(LDObjHandle &h, LBRealType load) {
+    LDObjLoadSample(h, load);
+  };
+
+  inline void GetObjLoadTrend(LDObjHandle &h, LDLoadTrend &t) {
+    LDGetObjLoadTrend(h, &t);
+  };
+
+  inline void SetObjLoadTrend(LDObjHandle &h, const LDLoadTrend &t) {
+    LDSetObjLoadTrend(h, &t);
+  };
+
+  inline LBRealType TotalLoadTrend() { return LDTotalLoadTrend(myLDHandle); };
+
   inline int RunningObject(LDObjHandle* _o) const { 
 #if CMK_LBDB_ON
       LBDB *const db = (LBDB*)(myLDHandle.handle);
@@ -365,6 +399,12 @@ public:
   inline void DecreaseLocalBarrier(LDBarrierClient h, int c) {
     LDDecreaseLocalBarrier(myLDHandle,h,c);
   }
+  inline int LocalBarrierEpoch(LDBarrierClient h) {
+    return LDLocalBarrierEpoch(myLDHandle,h);
+  }
+  inline void SetLocalBarrierEpoch(LDBarrierClient h, int epoch) {
+    LDSetLocalBarrierEpoch(myLDHandle,h,epoch);
+  }
   inline void LocalBarrierOn(void) { LDLocalBarrierOn(myLDHandle); };
   inline void LocalBarrierOff(void) { LDLocalBarrierOn(myLDHandle); };
   void ResumeClients();
@@ -390,6 +430,7 @@ public:
 
 private:
   int mystep;
+  int async_lb;			// clients resume before migrations are done
   LDHandle myLDHandle;
   static char *avail_vector;	// processor bit vector
   int new_ld_balancer;		// for Node 0
@@ -426,6 +467,14 @@ public:
 
   inline int step() { return mystep; }
   inline void incStep() { mystep++; }
+
+  // set by a load balancer that lets clients run while it balances;
+  // elements then hold back migrations while they wait at AtSync
+  inline int asyncLB() { return async_lb; }
+  inline void setAsyncLB(int on) {
+    async_lb = on;
+    LDLocalBarrierEpochs(myLDHandle, on);
+  }
 };
 
 void TurnManualLBOn();
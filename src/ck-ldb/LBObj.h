@@ -29,6 +29,9 @@ public:
 //    registered = true;
     startWTime = -1.0;
     lastWallTime = .0;
+    loadTrend.level = loadTrend.trend = .0;
+    loadTrend.samples = 0;
+    periodSamples = 0;
 #if CMK_LB_CPUTIMER
     startCTime = -1.0;
     lastCpuTime = .0;
@@ -40,6 +43,13 @@ public:
   void Clear(void);
 
   void IncrementTime(LBRealType walltime, LBRealType cputime);
+
+  // load trend, see LDLoadTrend
+  void AddLoadSample(LBRealType load);
+  void EndPeriod(void);
+  void LoadTrend(LDLoadTrend *t);
+  inline void SetLoadTrend(const LDLoadTrend &t) { loadTrend = t; }
+  LBRealType PredictedLoad(void);
   inline void StartTimer(void) {
 //	startWTime = CkWallTimer();
 	startWTime = CkCpuTimer();
@@ -110,6 +120,8 @@ private:
 //  bool registered;
   double startWTime;             // needs double precision
   LBRealType lastWallTime;
+  LDLoadTrend loadTrend;
+  int periodSamples;		// samples added since the last ClearLoads
 #if CMK_LB_CPUTIMER
   double startCTime;
   LBRealType lastCpuTime;
@@ -128,6 +128,9 @@ private:
     double avg_load;
     double min_utilization;
     double avg_utilization;
+    // load change per iteration, from the object load trends
+    double max_slope;
+    double avg_slope;
   };
 
   struct AdaptiveMetaBalancer {
@@ -189,6 +189,16 @@ typedef struct {
 #endif
 } LDObjData;
 
+/* load trend of an object by double exponential smoothing, in units of
+   one sample (an AtSync iteration with +MetaLB, else a load balancing
+   period); it moves with the object when it migrates */
+typedef struct {
+  LBRealType level;		// smoothed load of a sample
+  LBRealType trend;		// smoothed change of the load between samples
+  int samples;
+  inline void pup(PUP::er &p);
+} LDLoadTrend;
+
 /* used by load balancer */
 typedef struct {
   int index;
@@ -364,6 +374,10 @@ int  CLDCollectingStats(LDHandle _lbdb);
 void LDQueryEstLoad(LDHandle bdb);
 void LDGetObjLoad(LDObjHandle &h, LBRealType *wallT, LBRealType *cpuT);
 void LDQueryKnownObjLoad(LDObjHandle &h, LBRealType *wallT, LBRealType *cpuT);
+void LDObjLoadSample(LDObjHandle &h, LBRealType load);
+void LDGetObjLoadTrend(LDObjHandle &h, LDLoadTrend *t);
+void LDSetObjLoadTrend(LDObjHandle &h, const LDLoadTrend *t);
+LBRealType LDTotalLoadTrend(LDHandle _lbdb);
 
 int LDGetObjDataSz(LDHandle _lbdb);
 void LDGetObjData(LDHandle _lbdb, LDObjData *data);
@@ -431,6 +445,9 @@ void LDRemoveLocalBarrierClient(LDHandle _lbdb, LDBarrierClient h);
 LDBarrierReceiver LDAddLocalBarrierReceiver(LDHandle _lbdb,LDBarrierFn fn,
 					    void* data);
 void LDRemoveLocalBarrierReceiver(LDHandle _lbdb,LDBarrierReceiver h);
+void LDLocalBarrierEpochs(LDHandle _lbdb, int use);
+int LDLocalBarrierEpoch(LDHandle _lbdb, LDBarrierClient h);
+void LDSetLocalBarrierEpoch(LDHandle _lbdb, LDBarrierClient h, int epoch);
 
 #if CMK_LBDB_ON
 PUPbytes(LDHandle)
@@ -524,6 +541,13 @@ inline void LDObjData::pup(PUP::er &p) {
 }
 PUPmarshall(LDObjData)
 
+inline void LDLoadTrend::pup(PUP::er &p) {
+  p|level;
+  p|trend;
+  p|samples;
+}
+PUPmarshall(LDLoadTrend)
+
 inline bool LDCommDesc::operator==(const LDCommDesc &obj) const {
     if (type != obj.type) return false;
     switch (type) {
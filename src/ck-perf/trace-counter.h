@@ -75,6 +75,7 @@ class CountLogPool {
 	       int index1, long long count1, 
 	       int index2, long long count2, 
 	       double time);
+    void setEp(int epidx, int index, long long count, double time);
     void clearEps() { stats_.clear(); }
     void init(int argc) { stats_.init(argc); }
     void doReduction(int phase, double idleTime) { 
@@ -170,6 +171,7 @@ class TraceCounter : public Trace {
     int cancel_beginIdle, cancel_endIdle;
     
     // command line processing
+    CounterArg* choices_;       // the args that can be chosen on this PE
     CounterArg* firstArg_;      // pointer to start of linked list of args
     CounterArg* lastArg_;       // pointer to end of linked list of args
     int         argStrSize_;    // size of max arg string (formatted output)
@@ -205,6 +207,8 @@ class TraceCounter : public Trace {
     //! just print to screen
     void beginOverview();
     void endOverview();
+    //! record the counters read for one call of ep
+    void setEpCounters(int ep, long long value1, long long value2, double time);
     //! switch counters by whatever switching strategy 
     void switchCounters();
     //! add the argument parameters to the linked list of args choices
@@ -0,0 +1,183 @@
+/**
+ * \addtogroup CkPerf
+*/
+/*@{*/
+
+#ifndef _TRACE_PROJECTIONS_COMPACT_H
+#define _TRACE_PROJECTIONS_COMPACT_H
+
+#include <string.h>
+#include "conv-config.h"
+
+/*
+  Compact binary Projections log (+compact-trace), written to NAME.PE.clog
+  and turned back into the text log by projlogconv:
+
+    ProjCompactHeader
+    blocks     ProjCompactBlock, then the block data, LZ4 compressed
+               (stored raw when that does not make it smaller)
+    index      one ProjCompactIndex per block
+    ProjCompactFooter
+
+  A block holds the items LogEntry::pup writes for its records.  The
+  shape of a record is the tag byte of each item, giving its type, plus
+  PCL_COUNT and a varint count for arrays.  A record whose shape differs
+  from the last one of its type is written as PCL_RECORD, the varint
+  length of the shape, the shape and the values; otherwise as
+  PCL_RECORD_SAME and the values.  The first value is the record type.
+  Characters and floating point values are stored as they are.  A single
+  integer is stored as the zigzag varint of its difference to the same
+  item of the previous record of the same type, except the first
+  unsigned long (long) of a record, its time stamp, which is coded
+  against the time stamp of the previous record.  So times, entry points,
+  source PEs and message lengths mostly take a byte or two.  All of this
+  starts over in every block, so each block can be decoded on its own;
+  the index gives the offset, first time stamp and phase of each block.
+*/
+
+#define PROJ_COMPACT_MAGIC        "PROJCLOG"
+#define PROJ_COMPACT_INDEX_MAGIC  "PCLOGIDX"
+#define PROJ_COMPACT_VERSION      1
+#define PROJ_COMPACT_BLOCK        65536   // raw bytes per block
+#define PROJ_COMPACT_SLOTS        16      // items per record coded as deltas
+#define PROJ_COMPACT_SHAPE        64      // longest shape that is reused
+
+// item types, as the text writer prints them
+enum {
+  PCL_CHAR = 0, PCL_SHORT, PCL_INT, PCL_LONG, PCL_LONGLONG,
+  PCL_UCHAR, PCL_USHORT, PCL_UINT, PCL_ULONG, PCL_ULONGLONG,
+  PCL_FLOAT, PCL_DOUBLE, PCL_BYTE,
+  PCL_NTYPES
+};
+#define PCL_COUNT        0x80    // tag flag: a varint item count follows
+#define PCL_RECORD       0xff    // record with its shape
+#define PCL_RECORD_SAME  0xfe    // record shaped like the last of its type
+
+// bytes per value of the item types that are not varints, 0 for varints
+static inline int pclRawSize(int type)
+{
+  switch (type) {
+  case PCL_CHAR: case PCL_UCHAR: case PCL_BYTE: return 1;
+  case PCL_FLOAT: return sizeof(float);
+  case PCL_DOUBLE: return sizeof(double);
+  }
+  return 0;
+}
+
+typedef struct {
+  char magic[8];
+  int  version;
+  int  pe;
+  int  blockSize;
+  int  pad;
+} ProjCompactHeader;
+
+typedef struct {
+  int rawSize;
+  int storedSize;           // == rawSize if the block is not compressed
+} ProjCompactBlock;
+
+typedef struct {
+  CMK_TYPEDEF_INT8 offset;  // of the ProjCompactBlock in the file
+  int    rawSize;
+  int    storedSize;
+  int    records;
+  int    phase;             // END_PHASE records before this block
+  double firstTime;         // of the first record, in seconds
+} ProjCompactIndex;
+
+typedef struct {
+  CMK_TYPEDEF_INT8 indexOffset;
+  int  blocks;
+  int  pad;
+  char magic[8];
+} ProjCompactFooter;
+
+static inline int pclPutVarint(unsigned char *buf, CMK_TYPEDEF_UINT8 v)
+{
+  int n = 0;
+  while (v >= 0x80) {
+    buf[n++] = (unsigned char)(v | 0x80);
+    v >>= 7;
+  }
+  buf[n++] = (unsigned char)v;
+  return n;
+}
+
+// returns the number of bytes read, 0 if the varint runs past end
+static inline int pclGetVarint(const unsigned char *buf, const unsigned char *end,
+                               CMK_TYPEDEF_UINT8 &v)
+{
+  int n = 0, shift = 0;
+  v = 0;
+  while (buf + n < end && shift < 64) {
+    unsigned char c = buf[n++];
+    v |= (CMK_TYPEDEF_UINT8)(c & 0x7f) << shift;
+    if (!(c & 0x80)) return n;
+    shift += 7;
+  }
+  return 0;
+}
+
+static inline CMK_TYPEDEF_UINT8 pclZigzag(CMK_TYPEDEF_INT8 d)
+{
+  return ((CMK_TYPEDEF_UINT8)d << 1) ^ (CMK_TYPEDEF_UINT8)(d >> 63);
+}
+
+static inline CMK_TYPEDEF_INT8 pclUnzigzag(CMK_TYPEDEF_UINT8 z)
+{
+  return (CMK_TYPEDEF_INT8)(z >> 1) ^ -(CMK_TYPEDEF_INT8)(z & 1);
+}
+
+/// Delta and shape state, kept identically by the writer and the reader
+/// of a block.
+class ProjCompactCoder {
+  CMK_TYPEDEF_UINT8 prev[256][PROJ_COMPACT_SLOTS];
+  CMK_TYPEDEF_UINT8 prevTime;
+  unsigned char shape[256][PROJ_COMPACT_SHAPE];
+  int shapeLen[256];
+  int type;                 // of the current record, its first item
+  int item;                 // items of the current record seen so far
+  bool timeSeen;
+public:
+  ProjCompactCoder() { reset(); }
+  void reset() {
+    memset(prev, 0, sizeof(prev));
+    memset(shapeLen, 0, sizeof(shapeLen));
+    prevTime = 0;
+    type = 0;
+    item = 0;
+    timeSeen = false;
+  }
+  void beginRecord() { item = 0; timeSeen = false; }
+  bool firstItem() const { return item == 0; }
+  void setType(unsigned char t) { type = t; }
+
+  /// Moves on to the next item; for a single integer returns the previous
+  /// value to difference against, NULL if it is coded as it is.
+  CMK_TYPEDEF_UINT8 *next(int itemType, int n) {
+    int i = item++;
+    if (n != 1 || pclRawSize(itemType) > 0) return NULL;
+    if (!timeSeen && (itemType == PCL_ULONG || itemType == PCL_ULONGLONG)) {
+      timeSeen = true;
+      return &prevTime;
+    }
+    if (i >= PROJ_COMPACT_SLOTS) return NULL;
+    return &prev[type][i];
+  }
+
+  /// last shape of a record type, NULL if there is none to reuse
+  const unsigned char *getShape(int t, int &len) const {
+    len = shapeLen[t];
+    return len > 0 ? shape[t] : NULL;
+  }
+  void setShape(int t, const unsigned char *s, int len) {
+    if (len > PROJ_COMPACT_SHAPE) len = 0;
+    else memcpy(shape[t], s, len);
+    shapeLen[t] = len;
+  }
+};
+
+#endif
+
+/*@}*/
@@ -19,11 +19,24 @@
 #endif
 
 #include "pup.h"
+#include "trace-projections-compact.h"
 
 #define PROJECTION_VERSION  "7.0"
 
 #define PROJ_ANALYSIS 1
 
+// Filled log buffers are written by a background thread, one per process.
+// Needs pthreads, which only the SMP builds link with; the memory of the
+// entries handed over must not be touched by the PE while it is written,
+// which the BigSim and PAPI paths do.
+#ifndef CMK_PROJECTIONS_ASYNC_FLUSH
+#if CMK_SMP && !defined(_WIN32) && !CMK_BIGSIM_CHARM && !CMK_HAS_COUNTER_PAPI && !CMK_TRACE_LOGFILE_NUM_CONTROL
+#define CMK_PROJECTIONS_ASYNC_FLUSH 1
+#else
+#define CMK_PROJECTIONS_ASYNC_FLUSH 0
+#endif
+#endif
+
 // Macro to make projections check for errors before an fprintf succeeds.
 #define CheckAndFPrintF(f,string,data) \
 do { \
@@ -238,6 +251,8 @@ class LogEntry {
 class TraceProjections;
 
 /// log pool in trace projection
+class toProjectionsCompactFile;
+
 class LogPool {
   friend class TraceProjections;
 #ifdef PROJ_ANALYSIS
@@ -253,6 +268,15 @@ class LogPool {
     unsigned int poolSize;
     unsigned int numEntries;
     LogEntry *pool;
+    // double buffering for background flushes
+    int asyncFlush;
+    LogEntry *flushPool;          // buffer handed to (or back from) the writer
+    unsigned int flushEntries;
+    volatile int flushPending;    // writer has not finished flushPool yet
+    LogPool *nextFlush;           // queue of pools waiting for the writer
+    // time the PE was held up by flushes of this log
+    int flushStalls;
+    double flushStallTime;
     FILE *fp;
     FILE *deltafp;
     FILE *stsfp;
@@ -263,6 +287,8 @@ class LogPool {
     char *dfname;
     char *pgmname;
     int binary;
+    int compact;
+    toProjectionsCompactFile *compactLog;
     int nSubdirs;
 #if CMK_PROJECTIONS_USE_ZLIB
     gzFile deltazfp;
@@ -286,6 +312,11 @@ class LogPool {
     int headerWritten;
     bool fileCreated;
     void writeHeader();
+    void writeEntries(PUP::er &p, LogEntry *entries, UInt n, int writedelta, bool *phases);
+    void putEntry(PUP::er &p, LogEntry &e);
+    double waitFlush();
+    void queueFlush();
+    static void *flushWriter(void *);
 
     // for statistics 
     double beginComputationTime;
@@ -315,8 +346,10 @@ class LogPool {
     LogPool(char *pgm);
     ~LogPool();
     void setBinary(int b) { binary = b; }
+    void setCompact(int c) { compact = c; }
     void setNumSubdirs(int n) { nSubdirs = n; }
     void setWriteSummaryFiles(int n) { writeSummaryFiles = n;}
+    void setAsyncFlush(int a) { asyncFlush = a; }
 #if CMK_PROJECTIONS_USE_ZLIB
     void setCompressed(int c) { compressed = c; }
 #endif
@@ -370,6 +403,7 @@ class LogPool {
 
     void addCreationMulticast(unsigned short mIdx,unsigned short eIdx,double time,int event,int pe, int ml=0, CmiObjId* id=0, double recvT=0., int numPe=0, int *pelist=NULL);
     void flushLogBuffer();
+    void writeFlushed();
     void postProcessLog();
 
     void setWriteData(bool b){
@@ -582,6 +616,42 @@ class toProjectionsGZFile : public PUP::er {
 };
 #endif
 
+/// Writes log entries in the compact binary format of
+/// trace-projections-compact.h; one per log file, kept across flushes.
+class toProjectionsCompactFile : public PUP::er {
+  FILE *f;
+  ProjCompactCoder coder;
+  unsigned char *buf;       // raw data of the block being filled
+  int len, cap;
+  char *zbuf;               // its compressed form
+  unsigned char *shape, *vals;  // of the record being pupped
+  int shapeLen, shapeCap, valsLen, valsCap;
+  bool inRecord;
+  CkVec<ProjCompactIndex> index;
+  CMK_TYPEDEF_INT8 offset;  // where the next block goes in the file
+  int records;              // in the current block
+  int phase;                // END_PHASE records so far
+  int firstPhase;           // of the current block
+  double firstTime;
+
+  void reserve(int n);
+  void endRecord();
+  void writeBlock();
+ protected:
+  virtual void bytes(void *p,int n,size_t itemSize,dataType t);
+ public:
+  toProjectionsCompactFile(FILE *f_, int pe);
+  ~toProjectionsCompactFile();
+  /// grow the buffers to what writing these entries can need; called on
+  /// the PE before handing them to the writer thread, which must not
+  /// allocate
+  void prepare(LogEntry *entries, int n);
+  /// call before pupping each entry
+  void beginRecord(const LogEntry &e);
+  /// write the last block, the index and the footer
+  void finish();
+};
+
 
 
 
@@ -4,6 +4,7 @@
 #include "ckcallback-ccs.h"
 
 #include <set>
+#include <map>
 
 #ifndef PROJ_ANALYSIS
 // NOTE: Needed to handle the automatically-generated method so 
@@ -141,9 +142,11 @@ class TraceProjectionsBOC : public CBase_TraceProjectionsBOC {
   int endPe;                          // end PE which calls CkExit()
   std::set<int> list;
   int          flush_count;
+  int          stall_count;           // flushes that held up a PE
+  std::map<int,double> stall_time;    // seconds held up, per PE
  public:
- TraceProjectionsBOC(bool _findOutliers, bool _findStartTime) : findOutliers(_findOutliers), findStartTime(_findStartTime), parModulesRemaining(0), endPe(-1), flush_count(0) {};
- TraceProjectionsBOC(CkMigrateMessage *m):CBase_TraceProjectionsBOC(m), parModulesRemaining(0), endPe(-1), flush_count(0) {};
+ TraceProjectionsBOC(bool _findOutliers, bool _findStartTime) : findOutliers(_findOutliers), findStartTime(_findStartTime), parModulesRemaining(0), endPe(-1), flush_count(0), stall_count(0) {};
+ TraceProjectionsBOC(CkMigrateMessage *m):CBase_TraceProjectionsBOC(m), parModulesRemaining(0), endPe(-1), flush_count(0), stall_count(0) {};
 
   void traceProjectionsParallelShutdown(int);
   void startTimeAnalysis();
@@ -159,7 +162,7 @@ class TraceProjectionsBOC : public CBase_TraceProjectionsBOC {
 
   void ccsOutlierRequest(CkCcsRequestMsg *);
 
-  void flush_warning(int pe);
+  void flush_warning(int pe, double stall);
   void print_warning();
 };
 #endif
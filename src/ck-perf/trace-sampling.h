@@ -0,0 +1,126 @@
+/**
+ * \addtogroup CkPerf
+ */
+/*@{*/
+
+#ifndef _TRACE_SAMPLING_H
+#define _TRACE_SAMPLING_H
+
+#include <stdio.h>
+
+#include "charm++.h"
+
+#include "trace.h"
+#include "envelope.h"
+#include "register.h"
+#include "trace-common.h"
+#include "ckcallback-ccs.h"
+
+#include "TraceSampling.decl.h"
+
+/*
+  Continuous, low overhead tracing (-tracemode sampling).
+
+  Every execution of an entry method only bumps a per-PE call counter.
+  About one in +sampling-rate executions, picked by a randomized
+  countdown so that periodic message patterns do not alias with it, is
+  timed and its duration added to a histogram of its entry method.  The
+  histograms have a fixed number of power of two buckets, so the memory
+  used does not grow with the length of the run.
+
+  Every +sampling-period seconds PE 0 collects the counters of all PEs
+  in a reduction and keeps the result, which the CCS handler
+  "CkPerfSampling" returns as text.  Counters are cumulative from the
+  start of the run; a monitor scraping them derives rates itself.
+*/
+
+#define SAMPLING_BUCKETS     32       // bucket 0: < 1us, bucket b: [2^(b-1), 2^b) us
+#define SAMPLING_FIELDS      (4+SAMPLING_BUCKETS)  // calls samples time max hist
+#define SAMPLING_NO_EP       -1
+
+/* readonly */ extern CProxy_TraceSamplingBOC traceSamplingGroupProxy;
+
+void collectSamplingData(void *data, double currT);
+CkReductionMsg *samplingReduction(int nMsg, CkReductionMsg **msgs);
+
+/// per entry method counters, kept on every PE
+class SamplingEntry {
+ public:
+  CMK_TYPEDEF_UINT8 calls;      // all executions
+  CMK_TYPEDEF_UINT8 samples;    // timed executions
+  double time;                  // of the samples, in seconds
+  double maxTime;
+  unsigned int hist[SAMPLING_BUCKETS];
+
+  SamplingEntry() { memset(this, 0, sizeof(SamplingEntry)); }
+};
+
+class TraceSampling : public Trace {
+  SamplingEntry *entries;
+  int numEntries;
+  int rate;                     // time one in rate executions on average
+  int countdown;                // executions until the next sample
+  unsigned int seed;            // of the countdown
+  int execEp;                   // being timed, SAMPLING_NO_EP if none
+  int execDepth;                // nesting depth execEp began at
+  int depth;                    // of beginExecute calls, for direct calls
+  double start;
+
+  inline int nextCountdown() {
+    if (rate <= 1) return 1;
+    // xorshift; uniform in [1, 2*rate-1] has mean rate
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return 1 + seed % (2*rate - 1);
+  }
+
+ public:
+  TraceSampling(char **argv);
+
+  /// Allocate the counters once the number of entry methods is known
+  void initMem();
+
+  void beginExecute(envelope *e);
+  void beginExecute(CmiObjId *tid);
+  void beginExecute(int event,int msgType,int ep,int srcPe, int mlen=0, CmiObjId *idx=NULL);
+  void endExecute(void);
+  void beginComputation(void) { initMem(); }
+
+  inline int getNumEntries() const { return numEntries; }
+  inline int getRate() const { return rate; }
+  inline const SamplingEntry &getEntry(int ep) const { return entries[ep]; }
+};
+
+/** A main chare that creates the group and starts the periodic collection */
+class TraceSamplingInit : public Chare {
+ public:
+  TraceSamplingInit(CkArgMsg *m);
+};
+
+class TraceSamplingBOC : public CBase_TraceSamplingBOC {
+  CkReductionMsg *latest;       // on PE 0, the last collected counters
+  double latestTime;
+  bool collecting;
+
+ public:
+  TraceSamplingBOC() : latest(NULL), latestTime(0.0), collecting(false) {}
+  TraceSamplingBOC(CkMigrateMessage* msg) : latest(NULL), latestTime(0.0), collecting(false) {}
+  ~TraceSamplingBOC() { delete latest; }
+
+  /// false while the previous collection is still under way
+  inline bool startCollecting() {
+    if (collecting) return false;
+    collecting = true;
+    return true;
+  }
+
+  /// Entry methods:
+  void ccsRequestSampling(CkCcsRequestMsg *m);
+  void collectData();
+  void dataCollected(CkReductionMsg *);
+};
+
+#endif
+
+/*@}*/
@@ -125,6 +125,10 @@ protected:
       int ml,      // message size
       CmiObjId* idx)    // index
     { }
+    // as above, for modules that also look at the message
+    virtual void beginExecute(envelope *env, int event, int msgType, int ep,
+                              int srcPe, int ml, CmiObjId* idx)
+    { beginExecute(event, msgType, ep, srcPe, ml, idx); }
     virtual void changeLastEntryTimestamp(double ts) {}
     virtual void endExecute(void) {}
     virtual void endExecute(char *) {}
@@ -238,6 +242,7 @@ public:
     inline void beginExecute(char *msg) {ALLDO(beginExecute(msg));}
     inline void beginExecute(CmiObjId *tid) {ALLDO(beginExecute(tid));}
     inline void beginExecute(int event,int msgType,int ep,int srcPe, int mlen,CmiObjId *idx=NULL) {ALLDO(beginExecute(event, msgType, ep, srcPe, mlen,idx));}
+    inline void beginExecute(envelope *env,int event,int msgType,int ep,int srcPe, int mlen,CmiObjId *idx=NULL) {ALLDO(beginExecute(env, event, msgType, ep, srcPe, mlen,idx));}
     inline void endExecute(void) {ALLREVERSEDO(endExecute());}
     inline void endExecute(char *msg) {ALLREVERSEDO(endExecute(msg));}
     inline void changeLastEntryTimestamp(double ts) {ALLDO(changeLastEntryTimestamp(ts));}
@@ -331,6 +336,7 @@ extern "C" {
 #define _TRACE_END_SDAG(env) _TRACE_ONLY(CkpvAccess(_traces)->endSDAGBlock(env))
 #define _TRACE_BEGIN_EXECUTE(env) _TRACE_ONLY(CkpvAccess(_traces)->beginExecute(env))
 #define _TRACE_BEGIN_EXECUTE_DETAILED(evt,typ,ep,src,mlen,idx) _TRACE_ONLY(CkpvAccess(_traces)->beginExecute(evt,typ,ep,src,mlen,idx))
+#define _TRACE_BEGIN_EXECUTE_ENV_DETAILED(env,evt,typ,ep,src,mlen,idx) _TRACE_ONLY(CkpvAccess(_traces)->beginExecute(env,evt,typ,ep,src,mlen,idx))
 #define _TRACE_END_EXECUTE() _TRACE_ONLY(CkpvAccess(_traces)->endExecute())
 #define _TRACE_MESSAGE_RECV(env, pe) _TRACE_ONLY(CkpvAccess(_traces)->messageRecv(env, pe))
 #define _TRACE_BEGIN_PACK() _TRACE_ONLY(CkpvAccess(_traces)->beginPack())
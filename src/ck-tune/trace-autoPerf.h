@@ -181,6 +181,15 @@ public:
 
 #if CMK_HAS_COUNTER_PAPI
     LONG_LONG_PAPI papiValues[NUMPAPIEVENTS];
+#endif
+#if CMK_HAS_PERF_EVENT
+    CMK_TYPEDEF_INT8 perfEventValues[CMI_PERF_NUM_EVENTS];
+#endif
+#if CMK_AUTOPERF_CRITICAL_PATH
+    // longest path of the step, and what it is compared with
+    CkPathToken criticalPath;
+    double  utilTimeMax;
+    double  stepTimeMax;
 #endif
     // functions
     perfData(){}
@@ -256,6 +265,22 @@ public:
 
 #if CMK_HAS_COUNTER_PAPI
     LONG_LONG_PAPI previous_papiValues[NUMPAPIEVENTS];
+#endif
+#if CMK_HAS_PERF_EVENT
+    CMK_TYPEDEF_INT8 previous_perfEventValues[CMI_PERF_NUM_EVENTS];
+#endif
+#if CMK_AUTOPERF_CRITICAL_PATH
+    /** The step the paths belong to, counted by resetAll */
+    int pathStep;
+    /** Path of the executing entry method, extended up to pathMark */
+    CkPathToken currentPath;
+    /** Longest path an entry method on this PE ended in this step */
+    CkPathToken longestPath;
+    double pathMark;
+    int pathEp;
+    /** 1 while an entry method runs, 2 in an SDAG block or inline call in it */
+    int pathDepth;
+    int pathOuterEp;
 #endif
     double  lastBeginExecuteTime;
     int     lastbeginMessageSize;
@@ -369,6 +394,16 @@ public:
   /** Reset the idle, overhead, and memory measurements */
   void resetAll();
 
+#if CMK_AUTOPERF_CRITICAL_PATH
+  void beginPath(envelope *env, int ep);
+  void endPath();
+  void extendPath() {
+      double now = TraceTimer();
+      currentPath.add(pathEp, now - pathMark);
+      pathMark = now;
+  }
+#endif
+
   /*  mark one phase (to record begin and end timer ) */
   void markStep();
 
@@ -489,6 +524,23 @@ public:
       {
           currentSummary->papiValues[i] = (CkpvAccess(papiValues)[i] - previous_papiValues[i]);
       }
+#endif
+#if CMK_HAS_PERF_EVENT
+      CmiPerfEventsRead(currentSummary->perfEventValues);
+      for(int i=0; i<CMI_PERF_NUM_EVENTS; i++)
+      {
+          currentSummary->perfEventValues[i] -= previous_perfEventValues[i];
+      }
+#endif
+#if CMK_AUTOPERF_CRITICAL_PATH
+      // the entry method asking for the summary may be on the longest path
+      if(pathDepth > 0)
+          extendPath();
+      currentSummary->criticalPath = longestPath;
+      if(pathDepth > 0 && currentPath.length > longestPath.length)
+          currentSummary->criticalPath = currentPath;
+      currentSummary->utilTimeMax = currentSummary->utilTotalTime;
+      currentSummary->stepTimeMax = totalTraceTime();
 #endif
       return currentSummary;
   }
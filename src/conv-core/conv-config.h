@@ -88,6 +88,14 @@
 #define CMK_WITH_CONTROLPOINT            1
 #endif
 
+#ifndef  CMK_AUTOPERF_CRITICAL_PATH
+#define CMK_AUTOPERF_CRITICAL_PATH       0
+#endif
+
+#ifndef  CMK_FLAT_HASHTABLE
+#define CMK_FLAT_HASHTABLE               0
+#endif
+
 /* sanity checks */
 #if ! CMK_TRACE_ENABLED && CMK_SMP_TRACE_COMMTHREAD
 #undef CMK_SMP_TRACE_COMMTHREAD
@@ -3,6 +3,11 @@
   currently support origin2000 and PAPI
   PAPI implementation uses high level functions for single thread applications.
 
+  CmiPerfEvents* reads cycles, instructions, last level cache misses and
+  branch misses of the calling PE through Linux perf_event_open, with no
+  library needed.  The events are opened as one group, so a single read
+  returns all of them for the same interval.
+
   To instrument a code block:
 
    CmiStartCounters(...)
@@ -24,6 +29,13 @@ int read_counters(int e0, long long *c0, int e1, long long *c1);
 #include <papi.h>
 #endif
 
+#if CMK_HAS_PERF_EVENT
+#include <string.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
 void CmiInitCounters()
 {
 #if CMK_HAS_COUNTER_PAPI
@@ -68,4 +80,125 @@ void CmiStopCounters(int events[], CMK_TYPEDEF_INT8 values[], int numEvents)
 #endif
 }
 
+static const char *perfEventNames[CMI_PERF_NUM_EVENTS] = {
+  "CYCLES", "INSTRUCTIONS", "LLC_MISSES", "BRANCH_MISSES"
+};
+
+const char *CmiPerfEventName(int event)
+{
+  CmiAssert(event >= 0 && event < CMI_PERF_NUM_EVENTS);
+  return perfEventNames[event];
+}
+
+#if CMK_HAS_PERF_EVENT
+
+static const unsigned long long perfEventConfig[CMI_PERF_NUM_EVENTS] = {
+  PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+};
+
+typedef struct {
+  int fd[CMI_PERF_NUM_EVENTS];     /* -1 if the event could not be opened */
+  int slot[CMI_PERF_NUM_EVENTS];   /* position in the group read */
+  int numOpen;
+  int users;                       /* Open calls not yet Closed */
+} CmiPerfEvents;
+
+CpvStaticDeclare(CmiPerfEvents, perfEvents);
+
+/* called by every rank at startup, before any trace module opens them */
+void CmiPerfEventsInit(void)
+{
+  int i;
+  CpvInitialize(CmiPerfEvents, perfEvents);
+  for (i=0; i<CMI_PERF_NUM_EVENTS; i++)
+    CpvAccess(perfEvents).fd[i] = CpvAccess(perfEvents).slot[i] = -1;
+  CpvAccess(perfEvents).numOpen = 0;
+  CpvAccess(perfEvents).users = 0;
+}
+
+/* open the events for the calling thread, so each PE counts only itself;
+   returns how many of them could be opened (the hardware or the
+   perf_event_paranoid setting may not allow some).  Several trace modules
+   may open them, the events are shared and closed with the last Close. */
+int CmiPerfEventsOpen(void)
+{
+  CmiPerfEvents *pe;
+  struct perf_event_attr attr;
+  int i, leader = -1;
+
+  pe = &CpvAccess(perfEvents);
+  if (pe->users++ > 0) return pe->numOpen;
+  pe->numOpen = 0;
+  for (i=0; i<CMI_PERF_NUM_EVENTS; i++) {
+    pe->fd[i] = pe->slot[i] = -1;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = perfEventConfig[i];
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+    pe->fd[i] = syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+    if (pe->fd[i] < 0) continue;
+    if (leader < 0) leader = pe->fd[i];
+    pe->slot[i] = pe->numOpen++;
+  }
+  return pe->numOpen;
+}
+
+/* counts since CmiPerfEventsOpen, 0 for the events that are not open;
+   returns 0 if none is */
+int CmiPerfEventsRead(CMK_TYPEDEF_INT8 values[CMI_PERF_NUM_EVENTS])
+{
+  CmiPerfEvents *pe;
+  CMK_TYPEDEF_UINT8 buf[3+CMI_PERF_NUM_EVENTS];  /* nr, enabled, running */
+  double scale = 1.0;
+  int i, leader = -1;
+
+  for (i=0; i<CMI_PERF_NUM_EVENTS; i++) values[i] = 0;
+  pe = &CpvAccess(perfEvents);
+  for (i=0; i<CMI_PERF_NUM_EVENTS && pe->users > 0; i++)
+    if (leader < 0 && pe->fd[i] >= 0) leader = pe->fd[i];
+  if (leader < 0 || read(leader, buf, sizeof(buf)) < (ssize_t)(3*sizeof(CMK_TYPEDEF_UINT8)))
+    return 0;
+  /* the kernel multiplexes groups when it runs out of counters */
+  if (buf[2] > 0 && buf[2] < buf[1]) scale = (double)buf[1] / buf[2];
+  for (i=0; i<CMI_PERF_NUM_EVENTS; i++)
+    if (pe->slot[i] >= 0 && pe->slot[i] < (int)buf[0])
+      values[i] = (CMK_TYPEDEF_INT8)(buf[3+pe->slot[i]] * scale);
+  return 1;
+}
+
+void CmiPerfEventsClose(void)
+{
+  CmiPerfEvents *pe;
+  int i;
+  pe = &CpvAccess(perfEvents);
+  if (pe->users == 0 || --pe->users > 0) return;
+  /* the group leader goes last */
+  for (i=CMI_PERF_NUM_EVENTS-1; i>=0; i--)
+    if (pe->fd[i] >= 0) {
+      close(pe->fd[i]);
+      pe->fd[i] = pe->slot[i] = -1;
+    }
+  pe->numOpen = 0;
+}
+
+#else   /* no perf_event */
+
+void CmiPerfEventsInit(void) { }
+
+int CmiPerfEventsOpen(void) { return 0; }
 
+int CmiPerfEventsRead(CMK_TYPEDEF_INT8 values[CMI_PERF_NUM_EVENTS])
+{
+  int i;
+  for (i=0; i<CMI_PERF_NUM_EVENTS; i++) values[i] = 0;
+  return 0;
+}
+
+void CmiPerfEventsClose(void) { }
+
+#endif
@@ -3590,6 +3590,7 @@ void ConverseCommonInit(char **argv)
   }
 #endif
 	
+  CmiPerfEventsInit();
 #if CMK_TRACE_ENABLED
   traceInit(argv);
 /*initTraceCore(argv);*/ /* projector */
@@ -588,6 +588,10 @@ extern int CmiPrintCPUAffinity();
 extern int CmiSetCPUAffinity(int core);
 extern int CmiOnCore();
 
+extern int CmiGetMemAffinityNode(void);
+extern void CmiMemAffinityMove(void *ptr, size_t len);
+extern void *CmiMemAffinityAlloc(size_t len);
+
 /** Return 1 if our outgoing message queue 
    for this node is longer than this many bytes. */
 int CmiLongSendQueue(int forNode,int longerThanBytes);
@@ -1931,6 +1935,18 @@ void CmiInitCounters();
 void CmiStartCounters(int events[], int numEvents);
 void CmiStopCounters(int events[], CMK_TYPEDEF_INT8 values[], int numEvents);
 
+/* Linux perf_event counters of the calling PE, always counting once opened */
+#define CMI_PERF_CYCLES        0
+#define CMI_PERF_INSTRUCTIONS  1
+#define CMI_PERF_LLC_MISSES    2
+#define CMI_PERF_BRANCH_MISSES 3
+#define CMI_PERF_NUM_EVENTS    4
+void CmiPerfEventsInit(void);
+int  CmiPerfEventsOpen(void);
+int  CmiPerfEventsRead(CMK_TYPEDEF_INT8 values[CMI_PERF_NUM_EVENTS]);
+void CmiPerfEventsClose(void);
+const char *CmiPerfEventName(int event);
+
 /******** Trace ********/
 
 /* this is the type for thread ID, mainly used for projection. */
@@ -2026,6 +2042,7 @@ CpvExtern(int,charmLibExitFlag);
 
 /******** I/O wrappers ***********/
 
+size_t CmiFread(void *ptr, size_t size, size_t nmemb, FILE *f);
 size_t CmiFwrite(const void *ptr, size_t size, size_t nmemb, FILE *f);
 CmiInt8 CmiPwrite(int fd, char *buf, size_t bytes, size_t offset);
 FILE *CmiFopen(const char *path, const char *mode);
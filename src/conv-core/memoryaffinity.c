@@ -55,6 +55,59 @@ int print_mem_affinity() {
     CmiPrintf("%d: Mem affinity mask is: %08lx with policy %s\n", CmiMyPe(),mask,spol);
     return 0;
 }
+/* The NUMA node this PE's memory is bound to, or -1 if there is none */
+CpvStaticDeclare(int, memAffinityNid);
+
+int CmiGetMemAffinityNode(void) {
+    if (!CpvInitialized(memAffinityNid)) return -1;
+    return CpvAccess(memAffinityNid);
+}
+
+/**
+ * Move the pages lying wholly inside [ptr, ptr+len) to this PE's NUMA node.
+ * Meant for the large buffers of a migrated array element, from its
+ * ckJustMigrated: malloc may have recycled memory that another socket
+ * touched first.  Pages only partly covered are left alone, since other
+ * objects may share them.
+ */
+#define MEM_MOVE_BATCH 64  /* pages per move_pages call */
+void CmiMemAffinityMove(void *ptr, size_t len) {
+    int nid = CmiGetMemAffinityNode();
+    size_t pagesize, i, n;
+    char *start, *end;
+    void *pages[MEM_MOVE_BATCH];
+    int nodes[MEM_MOVE_BATCH], status[MEM_MOVE_BATCH];
+    if (nid < 0) return;
+    pagesize = getpagesize();
+    start = (char *)(((size_t)ptr + pagesize - 1) & ~(pagesize - 1));
+    end = (char *)(((size_t)ptr + len) & ~(pagesize - 1));
+    for (i=0; i<MEM_MOVE_BATCH; i++) nodes[i] = nid;
+    while (start < end) {
+        for (n=0; n<MEM_MOVE_BATCH && start<end; n++, start+=pagesize)
+            pages[n] = start;
+        /* move_pages, unlike mbind, leaves the heap's memory policy alone */
+        if (move_pages(0, n, pages, nodes, status, MPOL_MF_MOVE) < 0) {
+            DEBUGP(("%d: move_pages of %d pages failed\n", CmiMyPe(), (int)n));
+            return;
+        }
+    }
+}
+
+/**
+ * Allocate len bytes on this PE's NUMA node, to be released with free().
+ * Requests of at least a page are taken page-aligned and their pages moved
+ * here, so memory malloc recycled from another socket does not stay there.
+ * Smaller ones come from malloc, as they share pages with other objects.
+ */
+void *CmiMemAffinityAlloc(size_t len) {
+    size_t pagesize = getpagesize();
+    void *ptr;
+    if (CmiGetMemAffinityNode() < 0 || len < pagesize) return malloc(len);
+    if (posix_memalign(&ptr, pagesize, len) != 0) return NULL;
+    CmiMemAffinityMove(ptr, len);
+    return ptr;
+}
+
 static int CmiNumNUMANodes(void) {
     FILE *fp_nodes;
     int max_node=-1;
@@ -128,6 +181,9 @@ void CmiInitMemAffinity(char **argv) {
     CmiGetArgStringDesc(argv, "+mempol", &mpol, "define memory policy {bind, preferred or interleave} ");
 
 
+    CpvInitialize(int, memAffinityNid);
+    CpvAccess(memAffinityNid) = -1;
+
     if (!maffinity_flag) return;
 
     /*Currently skip the communication thread*/
@@ -214,6 +270,7 @@ void CmiInitMemAffinity(char **argv) {
         if (retval<0) {
             CmiAbort("set_mempolicy error w/ mem nodemap");
         }
+        if (policy!=MPOL_INTERLEAVE) CpvAccess(memAffinityNid) = myMemNid;
         free(nodemapArr);
     } else {
         /*use the affinity map set by the cpu affinity*/
@@ -234,12 +291,24 @@ void CmiInitMemAffinity(char **argv) {
         if (retval<0) {
             CmiAbort("set_mempolicy error w/o mem nodemap");
         }
+        if (policy!=MPOL_INTERLEAVE) CpvAccess(memAffinityNid) = myMemNid;
     }
 
     /*print_mem_affinity();*/
     CmiNodeAllBarrier();
 }
 #else
+int CmiGetMemAffinityNode(void) {
+    return -1;
+}
+
+void CmiMemAffinityMove(void *ptr, size_t len) {
+}
+
+void *CmiMemAffinityAlloc(size_t len) {
+    return malloc(len);
+}
+
 void CmiInitMemAffinity(char **argv) {
     char *tmpstr = NULL;
     int maffinity_flag = CmiGetArgFlagDesc(argv,"+maffinity",
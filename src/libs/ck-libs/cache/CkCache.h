@@ -7,6 +7,9 @@
 #include <set>
 #include "charm++.h"
 #include "envelope.h"
+#if CMK_FLAT_HASHTABLE
+#include "ckflathashtable.h"
+#endif
 
 #if COSMO_STATS > 0
 #include <fstream>
@@ -186,7 +189,11 @@ public:
 class CkCacheArrayCounter : public CkLocIterator {
 public:
   int count;
+#if CMK_FLAT_HASHTABLE
+  CkFlatHashtableT<CkArrayIndex, int> registered;
+#else
   CkHashtableT<CkArrayIndex, int> registered;
+#endif
   CkCacheArrayCounter() : count(0) { }
   void addLocation(CkLocation &loc) {
     registered.put(loc.getIndex()) = ++count;
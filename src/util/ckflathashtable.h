@@ -0,0 +1,297 @@
+/* Flat hash table with SIMD probing.
+
+   CkFlatHashtableT stores the same KEY/OBJ pairs as CkHashtableT, and
+   takes the same kind of KEY (with inline hash() and compare() routines),
+   but lays the table out the way Google's "Swiss table" does:
+
+   - Besides the array of key/object slots, there is one control byte per
+     slot: EMPTY, DELETED, or, for a full slot, 7 bits of the key's hash.
+   - A lookup compares the key's 7 hash bits against 16 control bytes at
+     once (one SSE2 compare and movemask), and only calls compare() on the
+     slots that match, which is almost always just the right one.
+   - Groups of 16 slots are probed quadratically until a group with an
+     EMPTY byte shows the key is absent, so the table can fill to 7/8.
+   - remove() leaves a DELETED marker rather than moving other entries,
+     so iterators stay valid across removals.
+
+   The key's hash code is remixed before use, so plain index-like codes
+   (CkArrayIndex, CkHashtableAdaptorT<int>) spread over the table.
+
+   CkHashtable's interface is kept (put/get/getRef/remove, iterator
+   with next(void **)), so the two can be swapped with a typedef; see
+   CMK_FLAT_HASHTABLE.
+*/
+#ifndef __CK_FLAT_HASHTABLE_H
+#define __CK_FLAT_HASHTABLE_H
+
+#include "ckhashtable.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define CK_FLATHASH_GROUP 16
+#define CK_FLATHASH_EMPTY ((signed char)-128)
+#define CK_FLATHASH_DELETED ((signed char)-2)
+
+/// Index of the lowest set bit of a nonzero group match
+inline int CkFlatHashFirstBit(unsigned int m)
+{
+#if defined(__GNUC__)
+  return __builtin_ctz(m);
+#else
+  int i=0;
+  while (!(m&1)) { m>>=1; i++; }
+  return i;
+#endif
+}
+
+/// The control bytes of 16 consecutive slots, starting anywhere
+class CkFlatHashGroup {
+#if defined(__SSE2__)
+  __m128i ctrl;
+public:
+  CkFlatHashGroup(const signed char *p)
+    :ctrl(_mm_loadu_si128((const __m128i *)p)) {}
+  /// Bit i is set if byte i is h2
+  unsigned int match(signed char h2) const
+    {return _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl,_mm_set1_epi8(h2)));}
+  /// Bit i is set if slot i is EMPTY or DELETED (both are below -1)
+  unsigned int matchFree(void) const
+    {return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1),ctrl));}
+#else
+  const signed char *ctrl;
+public:
+  CkFlatHashGroup(const signed char *p) :ctrl(p) {}
+  unsigned int match(signed char h2) const {
+    unsigned int m=0;
+    for (int i=0;i<CK_FLATHASH_GROUP;i++) if (ctrl[i]==h2) m|=1u<<i;
+    return m;
+  }
+  unsigned int matchFree(void) const {
+    unsigned int m=0;
+    for (int i=0;i<CK_FLATHASH_GROUP;i++) if (ctrl[i]<-1) m|=1u<<i;
+    return m;
+  }
+#endif
+  unsigned int matchEmpty(void) const {return match(CK_FLATHASH_EMPTY);}
+};
+
+/// Lists the objects of a CkFlatHashtableT; used like CkHashtableIterator.
+class CkFlatHashtableIterator {
+	const signed char *ctrl;
+	char *slots;
+	int len, entrySize, objOffset;
+	int curNo;//Table index of current object (to be returned next)
+public:
+	CkFlatHashtableIterator(const signed char *ctrl_,char *slots_,int len_,
+	                        int entrySize_,int objOffset_)
+	  :ctrl(ctrl_),slots(slots_),len(len_),entrySize(entrySize_),
+	   objOffset(objOffset_),curNo(0) {}
+
+	//Seek to start of hash table
+	void seekStart(void) {curNo=0;}
+
+	//Seek forward (or back) n hash slots (*not* n objects!)
+	void seek(int n) {
+		curNo+=n;
+		if (curNo<0) curNo=0;
+		if (curNo>len) curNo=len;
+	}
+
+	//Return 1 if next will be non-NULL
+	int hasNext(void) {
+		while (curNo<len && ctrl[curNo]<0) curNo++;
+		return curNo<len;
+	}
+
+	//Return the next object, or NULL if none.
+	// The corresponding object key will be returned in retKey.
+	void *next(void **retKey=NULL) {
+		if (!hasNext()) return NULL;
+		char *cur=slots+(curNo++)*entrySize;
+		if (retKey) *retKey=cur;
+		return cur+objOffset;
+	}
+};
+
+template <class KEY, class OBJ>
+class CkFlatHashtableT {
+	struct entry_t {
+		KEY k; //must stay first: iterators return the entry as the key
+		OBJ o;
+	};
+
+	int len;//Number of slots, a power of two, at least one group
+	int nObj;//Number of objects stored
+	int nDeleted;//Number of DELETED slots
+	int resizeAt;//Rehash when nObj+nDeleted reaches this (7/8 of len)
+	signed char *ctrl;//len control bytes, then a copy of the first group
+	entry_t *slots;//len key/object slots
+
+	CkFlatHashtableT(const CkFlatHashtableT &); //Don't use these
+	void operator=(const CkFlatHashtableT &);
+
+	//Spread the key's hash code over 64 bits: the top 7 bits become
+	// the control byte, and the high word picks the first group.
+	static inline CmiUInt8 mix(CkHashCode h)
+		{return (CmiUInt8)h*0x9E3779B97F4A7C15ULL;}
+	static inline signed char h2(CmiUInt8 x) {return (signed char)(x>>57);}
+	inline int h1(CmiUInt8 x) const {return (int)(x>>32)&(len-1);}
+
+	void setCtrl(int i,signed char c) {
+		ctrl[i]=c;
+		if (i<CK_FLATHASH_GROUP) ctrl[len+i]=c;
+	}
+
+	//Return the slot holding key, or -1
+	int find(const KEY &key,CmiUInt8 x) const {
+		signed char c=h2(x);
+		int pos=h1(x), step=0;
+		while (1) {
+			CkFlatHashGroup g(ctrl+pos);
+			for (unsigned int m=g.match(c);m;m&=m-1) {
+				int i=(pos+CkFlatHashFirstBit(m))&(len-1);
+				if (key.compare(slots[i].k)) return i;
+			}
+			if (g.matchEmpty()) return -1;
+			step+=CK_FLATHASH_GROUP;
+			pos=(pos+step)&(len-1);
+		}
+	}
+
+	//Return the first EMPTY or DELETED slot on x's probe sequence
+	int findFree(CmiUInt8 x) const {
+		int pos=h1(x), step=0;
+		while (1) {
+			unsigned int m=CkFlatHashGroup(ctrl+pos).matchFree();
+			if (m) return (pos+CkFlatHashFirstBit(m))&(len-1);
+			step+=CK_FLATHASH_GROUP;
+			pos=(pos+step)&(len-1);
+		}
+	}
+
+	void buildTable(int newLen) {
+		len=newLen;
+		nObj=nDeleted=0;
+		resizeAt=len-len/8;
+		ctrl=new signed char[len+CK_FLATHASH_GROUP];
+		for (int i=0;i<len+CK_FLATHASH_GROUP;i++) ctrl[i]=CK_FLATHASH_EMPTY;
+		slots=new entry_t[len];
+	}
+
+	//Move everything to a table of the given size, dropping DELETED slots
+	void rehash(int newLen) {
+		int oldLen=len;
+		signed char *oldCtrl=ctrl;
+		entry_t *oldSlots=slots;
+		buildTable(newLen);
+		for (int i=0;i<oldLen;i++)
+			if (oldCtrl[i]>=0) {
+				CmiUInt8 x=mix(oldSlots[i].k.hash());
+				int j=findFree(x);
+				setCtrl(j,h2(x));
+				slots[j]=oldSlots[i];
+				nObj++;
+			}
+		delete[] oldCtrl;
+		delete[] oldSlots;
+	}
+
+public:
+	//Constructor-- create an empty hash table with room for initLen
+	// objects.  The load factor is only accepted for compatibility with
+	// CkHashtableT: group probing stays fast up to 7/8 full.
+	CkFlatHashtableT(int initLen=5,float /*NloadFactor*/=0.5) {
+		int l=CK_FLATHASH_GROUP;
+		while (l-l/8<=initLen) l*=2;
+		buildTable(l);
+	}
+	~CkFlatHashtableT() {
+		delete[] ctrl;
+		delete[] slots;
+	}
+
+	//Add the given key to this table, and return its object storage.
+	// If existing is given, it is set to 1 if the key was already here.
+	OBJ &put(const KEY &key,int *existing=NULL) {
+		CmiUInt8 x=mix(key.hash());
+		int i=find(key,x);
+		if (existing) *existing=(i>=0);
+		if (i>=0) return slots[i].o;
+		if (nObj+nDeleted>=resizeAt) //grow, unless DELETED slots fill it
+			rehash(2*nObj>=resizeAt?2*len:len);
+		i=findFree(x);
+		if (ctrl[i]==CK_FLATHASH_DELETED) nDeleted--;
+		setCtrl(i,h2(x));
+		slots[i].k=key;
+		nObj++;
+		return slots[i].o;
+	}
+
+	//Return the object, or "0" if it doesn't exist
+	OBJ get(const KEY &key) const {
+		int i=find(key,mix(key.hash()));
+		if (i<0) return OBJ(0);
+		return slots[i].o;
+	}
+
+	//Use this version when you're sure the entry exists
+	OBJ &getRef(const KEY &key) {
+		return slots[find(key,mix(key.hash()))].o;
+	}
+
+	/* Remove this key from the hashtable.
+	   Returns the number of keys removed (always 0 or 1) */
+	int remove(const KEY &key) {
+		int i=find(key,mix(key.hash()));
+		if (i<0) return 0;
+		setCtrl(i,CK_FLATHASH_DELETED);
+		slots[i].o=OBJ();
+		nObj--;
+		nDeleted++;
+		return 1;
+	}
+
+	//Remove all objects and keys
+	void empty(void) {
+		for (int i=0;i<len;i++)
+			if (ctrl[i]>=0) slots[i].o=OBJ();
+		for (int i=0;i<len+CK_FLATHASH_GROUP;i++) ctrl[i]=CK_FLATHASH_EMPTY;
+		nObj=nDeleted=0;
+	}
+
+	int numObjects(void) const {return nObj;}
+
+	/* Return an iterator for the objects in this hash table.
+	   ** WARNING!!! ** This is a newly allocated memory that must be freed by the
+	   user with "delete" */
+	CkFlatHashtableIterator *iterator(void) {
+		return new CkFlatHashtableIterator(ctrl,(char *)slots,len,
+			sizeof(entry_t),(char *)&slots[0].o-(char *)&slots[0]);
+	}
+
+	void pup(PUP::er &p) {
+		if (!p.isUnpacking()) {
+			int hasNext=1;
+			for (int i=0;i<len;i++)
+				if (ctrl[i]>=0) {
+					p|hasNext;
+					p|slots[i].k;
+					p|slots[i].o;
+				}
+			hasNext=0; p|hasNext;
+		} else {
+			int hasNext=1;
+			p|hasNext;
+			while (hasNext) {
+				OBJ o; KEY k;
+				p|k;
+				p|o;
+				put(k)=o;
+				p|hasNext;
+			}
+		}
+	}
+};
+
+#endif
@@ -14,4 +14,12 @@ extern vector<int> int_to_Hilbert(int i, int dim) ;
  */
 extern int Hilbert_to_int(const vector<int>& coords, int dim);
 
+/*
+ *  position of the point 'coords' on the Hilbert (or Morton, Z-order) curve
+ *  through a cube of side 2^bits in dim dimensions (dim at most 8, dim*bits
+ *  at most 64)
+ */
+extern unsigned long long Hilbert_to_key(const int *coords, int dim, int bits);
+extern unsigned long long Morton_to_key(const int *coords, int dim, int bits);
+
 #endif
@@ -55,6 +55,7 @@ class bar {
 #define __CK_PUP_H
 
 #include <stdio.h> /*<- for "FILE *" */
+#include <string.h> /*<- for memcpy in the fast path */
 
 #ifndef __cplusplus
 #error "Use pup_c.h for C programs-- pup.h is for C++ programs"
@@ -980,6 +981,64 @@ PUP_BUILTIN_SUPPORT(CmiUInt16)
 #endif
 
 
+/************** PUP::er -- Non-virtual fast path ****************/
+namespace PUP {
+/**
+  Sizer and memory packers for code that knows which PUP::er it uses,
+  like the marshalling code charmxi generates: p|x and PUParray(p,x,n)
+  on builtin and PUPbytes types become an inline add or memcpy instead
+  of a virtual call to bytes().  Other types go through the sizer, toMem
+  or fromMem these derive from, so they pack the very same bytes.  A pup
+  routine written as a template over its PUP::er and called with one of
+  these gets the fast path for its fields too.  Do not derive from them:
+  an overridden bytes() would be bypassed.
+*/
+class fastSizer : public sizer {
+ public:
+  fastSizer(void) {}
+  template <class T> inline void fast(const T *,int n) {nBytes+=n*sizeof(T);}
+};
+
+class fastToMem : public toMem {
+ public:
+  fastToMem(void *Nbuf) :toMem(Nbuf) {}
+  template <class T> inline void fast(const T *p,int n)
+    {memcpy((void *)buf,(const void *)p,n*sizeof(T)); buf+=n*sizeof(T);}
+};
+
+class fastFromMem : public fromMem {
+ public:
+  fastFromMem(const void *Nbuf) :fromMem(Nbuf) {}
+  template <class T> inline void fast(T *p,int n)
+    {memcpy((void *)p,(const void *)buf,n*sizeof(T)); buf+=n*sizeof(T);}
+};
+
+/// fast_if<c>::type is void when c holds, and absent otherwise, which
+/// drops the overloads below for types not copied as bytes
+template <bool c> struct fast_if {};
+template <> struct fast_if<true> {typedef void type;};
+
+#if !defined(CK_CHECK_PUP) && !defined(CK_DEFAULT_BITWISE_PUP)   /* checked PUP::ers write a record per call */
+#define PUP_FAST_PATH(er_t) \
+  template <class T> inline typename fast_if<as_bytes<T>::value>::type \
+    operator|(er_t &p,T &t) {p.fast(&t,1);} \
+  template <class T> inline typename fast_if<as_bytes<T>::value>::type \
+    PUParray(er_t &p,T *ta,int n) {p.fast(ta,n);}
+PUP_FAST_PATH(fastSizer)
+PUP_FAST_PATH(fastToMem)
+PUP_FAST_PATH(fastFromMem)
+#undef PUP_FAST_PATH
+#endif
+}
+
+/// Bytes p|x packs for a builtin x, as a compile-time constant: charmxi's
+/// marshalling code adds these up instead of sizing such parameters.
+#ifndef CK_CHECK_PUP
+#define PUP_FIXED_SIZE(type) ((int)sizeof(type))
+#else /* each call also writes an 8-byte pupCheckRec (see pup_util.C) */
+#define PUP_FIXED_SIZE(type) ((int)sizeof(type)+8)
+#endif
+
 //This macro is useful in simple pup routines:
 //  It's just p|x, but it also documents the *name* of the variable.
 // You must have a PUP::er named p.
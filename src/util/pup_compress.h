@@ -0,0 +1,177 @@
+/*
+Compressed PUP streams, used for checkpoints (+chkpt_compress).
+
+The packed bytes are cut into chunks of PUP_COMPRESS_CHUNK bytes and
+each chunk is compressed on its own:
+
+    PUP_compressHeader
+    chunks    PUP_compressChunk, then storedSize bytes of data
+    end       a PUP_compressChunk with rawSize 0
+
+A chunk is stored raw (codec PUP_COMPRESS_NONE) when the codec does not
+make it smaller.  The codecs are:
+
+  lz4    the bundled LZ4 (lz4.c).
+  float  the exponent-matching scheme of compressDouble in
+         src/arch/util/compress.c, applied to the 8-byte words of the
+         chunk: a 2-bit code per word tells whether its top 16 or 8 bits
+         are those of the previous word, in which case only the low 6 or
+         7 bytes are kept.  The previous word plays the part of the base
+         buffer, so smooth double precision fields shrink by up to 25%.
+         When packing through PUP_toCompressed, arrays of doubles are
+         aligned to 8 bytes in the stream so their words line up.
+
+PUP_fromCompressed reads a file without the header as a plain
+PUP::fromDisk would, so uncompressed checkpoints can still be restarted.
+
+Both support PUP::seekBlock.  Offsets are those of the uncompressed
+stream: the bytes of an outermost seek block are held in memory until it
+ends, so the packer can go back to fill in the section table before the
+block is compressed, and the unpacker can go back to a section it has
+already decompressed.
+*/
+#ifndef __PUP_COMPRESS_H
+#define __PUP_COMPRESS_H
+
+#include <stdio.h>
+#include "pup.h"
+
+#define PUP_COMPRESS_MAGIC  "PUPZCHK1"
+#define PUP_COMPRESS_CHUNK  65536   // raw bytes per chunk
+
+enum {
+  PUP_COMPRESS_NONE = 0,
+  PUP_COMPRESS_LZ4,
+  PUP_COMPRESS_FLOAT,
+  PUP_COMPRESS_NCODECS
+};
+
+typedef struct {
+  char magic[8];
+  int  codec;                 // of the stream, chunks may be stored raw
+  int  chunkSize;
+} PUP_compressHeader;
+
+typedef struct {
+  int rawSize;
+  int storedSize;
+  int codec;                  // PUP_COMPRESS_NONE if stored raw
+} PUP_compressChunk;
+
+/// Codec called name ("none", "lz4" or "float"), -1 if there is none
+int PUP_compressCodec(const char *name);
+const char *PUP_compressCodecName(int codec);
+
+/// Most bytes PUP_compressBuffer writes for len bytes
+size_t PUP_compressBound(size_t len);
+
+/// Compress len bytes of src into a stream at dest, return its length
+size_t PUP_compressBuffer(int codec, const void *src, size_t len, void *dest);
+
+/// Decompress the stream of len bytes at src into dest, which holds
+/// rawLen bytes; return the number of bytes written, or 0 if the stream
+/// is corrupt or does not fit
+size_t PUP_decompressBuffer(const void *src, size_t len, void *dest, size_t rawLen);
+
+/// Packs into a compressed stream written to a file, or kept in memory
+/// when there is no file.  Call finish() before closing the file or
+/// taking the buffer.
+class PUP_toCompressed : public PUP::er {
+	FILE *F;                // NULL when packing into mem
+	char *mem;
+	size_t memLen, memMax;
+	int codec;
+	char *raw;              // the chunk being filled
+	int rawLen;
+	char *out;              // compressed chunk
+	size_t rawBytes;        // packed, with the alignment of doubles
+	size_t storedBytes;     // written to the file
+	double time;            // spent compressing
+	size_t at;              // raw offset the next bytes are packed at
+	int seekDepth;          // seek blocks open
+	char *hold;             // packed since the outermost seek block began
+	size_t holdStart, holdLen, holdMax;
+	void init(void);
+	void write(const void *p, size_t n);
+	void flushChunk(void);
+	void put(const char *p, size_t n);
+	void putChunks(const char *p, size_t n);
+ protected:
+	virtual void bytes(void *p,int n,size_t itemSize,PUP::dataType t);
+	virtual void impl_startSeek(PUP::seekBlock &s);
+	virtual int impl_tell(PUP::seekBlock &s);
+	virtual void impl_seek(PUP::seekBlock &s,int off);
+	virtual void impl_endSeek(PUP::seekBlock &s);
+ public:
+	PUP_toCompressed(FILE *f,int codec);
+	PUP_toCompressed(int codec);
+	~PUP_toCompressed();
+
+	/// Write the last chunk and the end of the stream
+	void finish(void);
+
+	size_t getRawBytes(void) const {return rawBytes;}
+	size_t getStoredBytes(void) const {return storedBytes;}
+	double getTime(void) const {return time;}
+	int getCodec(void) const {return codec;}
+
+	/// The stream packed into memory, getStoredBytes() long; the caller
+	/// frees it with free()
+	char *releaseBuffer(void);
+};
+
+/// Unpacks a stream written by PUP_toCompressed, or a plain file
+class PUP_fromCompressed : public PUP::er {
+	FILE *F;
+	int codec;              // -1 for a plain file
+	int chunkSize;
+	char *raw;              // the chunk being read
+	int rawLen, rawPos;
+	size_t pos;             // bytes unpacked, for the alignment of doubles
+	char *in;
+	int seekDepth;          // seek blocks open
+	char *hold;             // unpacked since the outermost seek block began
+	size_t holdStart, holdLen, holdMax;
+	bool nextChunk(void);
+	void read(char *p, size_t n);
+	void fill(size_t len);
+	void get(char *p, size_t n);
+ protected:
+	virtual void bytes(void *p,int n,size_t itemSize,PUP::dataType t);
+	virtual void impl_startSeek(PUP::seekBlock &s);
+	virtual int impl_tell(PUP::seekBlock &s);
+	virtual void impl_seek(PUP::seekBlock &s,int off);
+	virtual void impl_endSeek(PUP::seekBlock &s);
+ public:
+	PUP_fromCompressed(FILE *f);
+	~PUP_fromCompressed();
+	bool isCompressed(void) const {return codec >= 0;}
+	int getCodec(void) const {return codec < 0 ? PUP_COMPRESS_NONE : codec;}
+};
+
+/// Pad a stream of PUP_toCompressed or PUP_fromCompressed to 8 bytes, as
+/// before an array of doubles; other PUP::ers are left alone.  Data
+/// packed after it is laid out the same wherever it is in the stream.
+void PUP_compressAlign(PUP::er &p);
+
+/// Sizes data as PUP_toCompressed with this codec packs it after
+/// PUP_compressAlign, padding included
+class PUP_sizeCompressed : public PUP::sizer {
+	int codec;
+ protected:
+	virtual void bytes(void *p,int n,size_t itemSize,PUP::dataType t);
+ public:
+	PUP_sizeCompressed(int codec_) :codec(codec_) {}
+};
+
+/// Unpacks data that PUP_toCompressed packed after PUP_compressAlign, once
+/// copied out of the stream as raw bytes, padding included
+class PUP_fromCompressedMem : public PUP::fromMem {
+	int codec;
+ protected:
+	virtual void bytes(void *p,int n,size_t itemSize,PUP::dataType t);
+ public:
+	PUP_fromCompressedMem(const void *buf,int codec_) :PUP::fromMem(buf), codec(codec_) {}
+};
+
+#endif
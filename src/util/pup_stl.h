@@ -9,7 +9,12 @@ This includes variables of type "std::list<int>", or even
 "std::map<double, std::vector<std::string> >".
 
 NOT included are the rarer types like valarray or slice, 
-vector<bool>, set or multiset, or deque.
+vector<bool>, or multiset.
+
+Vectors of types copied as bytes (see PUP::as_bytes: builtins and
+PUPbytes types) are pupped with a single PUParray; other containers
+pup their items one at a time, and unpack into reserved vectors and,
+since the items come out sorted, with hinted inserts into maps and sets.
 
 Orion Sky Lawlor, olawlor@acm.org, 7/22/2002
 */
@@ -21,6 +26,7 @@ Orion Sky Lawlor, olawlor@acm.org, 7/22/2002
  */
 #include <set>
 #include <vector>
+#include <deque>
 #include <list>
 #include <map>
 #include <string>
@@ -52,6 +58,8 @@ namespace PUP {
   inline void operator|(er &p,typename std::vector<T> &v);
   template <class T>
   inline void operator|(er &p,typename std::list<T> &v);
+  template <class T>
+  inline void operator|(er &p,typename std::deque<T> &v);
   template <class V,class T,class Cmp>
   inline void operator|(er &p,typename std::map<V,T,Cmp> &m);
   template <class V,class T,class Cmp>
@@ -139,6 +147,12 @@ namespace PUP {
     }
   }
 
+  //Impl. util: make room for nElem items before unpacking them
+  template <class container>
+  inline void PUP_stl_reserve(container &c,int nElem) { }
+  template <class T>
+  inline void PUP_stl_reserve(std::vector<T> &c,int nElem) { c.reserve(nElem); }
+
   template <class container,class dtype>
   inline void PUP_stl_container(er &p,container &c) {
     p.syncComment(sync_begin_array);
@@ -146,6 +160,7 @@ namespace PUP {
     if (p.isUnpacking()) 
       { //Unpacking: Extract each element and push_back:
 	c.resize(0);
+	PUP_stl_reserve(c,nElem);
 	for (int i=0;i<nElem;i++) {
 	  p.syncComment(sync_item);
 	  dtype n;
@@ -163,11 +178,12 @@ namespace PUP {
     p.syncComment(sync_begin_list);
     int nElem=PUP_stl_container_size(p,c);
     if (p.isUnpacking()) 
-      { //Unpacking: Extract each element and insert:
+      { //Unpacking: Extract each element and insert.  The items were
+	// packed in order, so each goes at the end.
 	for (int i=0;i<nElem;i++) {
 	  dtype n;
 	  p|n;
-	  c.insert(n);
+	  c.insert(c.end(),n);
 	} 
       }
     else PUP_stl_container_items<container, dtype>(p,c);
@@ -176,10 +192,22 @@ namespace PUP {
 
   template <class T> 
   inline void operator|(er &p,typename std::vector<T> &v)
-  { PUP_stl_container<std::vector<T>,T>(p,v); }
+  {
+    if (as_bytes<T>::value && !p.hasComments()) {
+      // contiguous items copied as bytes: the same stream as item by
+      // item, in one call
+      int nElem=PUP_stl_container_size(p,v);
+      if (p.isUnpacking()) v.resize(nElem);
+      if (nElem>0) PUParray(p,&v[0],nElem);
+    }
+    else PUP_stl_container<std::vector<T>,T>(p,v);
+  }
   template <class T> 
   inline void operator|(er &p,typename std::list<T> &v)
   { PUP_stl_container<std::list<T>,T>(p,v); }
+  template <class T> 
+  inline void operator|(er &p,typename std::deque<T> &v)
+  { PUP_stl_container<std::deque<T>,T>(p,v); }
 
   template <class V,class T,class Cmp> 
   inline void operator|(er &p,typename std::map<V,T,Cmp> &m)
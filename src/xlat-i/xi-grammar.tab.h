@@ -1,23 +1,22 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* A Bison parser, made by GNU Bison 2.4.1.  */
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-/* Skeleton interface for Bison's Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
-   
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -28,90 +27,113 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
 
-/* Tokens.  */
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     MODULE = 258,
-     MAINMODULE = 259,
-     EXTERN = 260,
-     READONLY = 261,
-     INITCALL = 262,
-     INITNODE = 263,
-     INITPROC = 264,
-     PUPABLE = 265,
-     CHARE = 266,
-     MAINCHARE = 267,
-     GROUP = 268,
-     NODEGROUP = 269,
-     ARRAY = 270,
-     MESSAGE = 271,
-     CONDITIONAL = 272,
-     CLASS = 273,
-     INCLUDE = 274,
-     STACKSIZE = 275,
-     THREADED = 276,
-     TEMPLATE = 277,
-     SYNC = 278,
-     IGET = 279,
-     EXCLUSIVE = 280,
-     IMMEDIATE = 281,
-     SKIPSCHED = 282,
-     INLINE = 283,
-     VIRTUAL = 284,
-     MIGRATABLE = 285,
-     CREATEHERE = 286,
-     CREATEHOME = 287,
-     NOKEEP = 288,
-     NOTRACE = 289,
-     APPWORK = 290,
-     VOID = 291,
-     CONST = 292,
-     PACKED = 293,
-     VARSIZE = 294,
-     ENTRY = 295,
-     FOR = 296,
-     FORALL = 297,
-     WHILE = 298,
-     WHEN = 299,
-     OVERLAP = 300,
-     ATOMIC = 301,
-     IF = 302,
-     ELSE = 303,
-     PYTHON = 304,
-     LOCAL = 305,
-     NAMESPACE = 306,
-     USING = 307,
-     IDENT = 308,
-     NUMBER = 309,
-     LITERAL = 310,
-     CPROGRAM = 311,
-     HASHIF = 312,
-     HASHIFDEF = 313,
-     INT = 314,
-     LONG = 315,
-     SHORT = 316,
-     CHAR = 317,
-     FLOAT = 318,
-     DOUBLE = 319,
-     UNSIGNED = 320,
-     ACCEL = 321,
-     READWRITE = 322,
-     WRITEONLY = 323,
-     ACCELBLOCK = 324,
-     MEMCRITICAL = 325,
-     REDUCTIONTARGET = 326,
-     CASE = 327
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    MODULE = 258,                  /* MODULE  */
+    MAINMODULE = 259,              /* MAINMODULE  */
+    EXTERN = 260,                  /* EXTERN  */
+    READONLY = 261,                /* READONLY  */
+    INITCALL = 262,                /* INITCALL  */
+    INITNODE = 263,                /* INITNODE  */
+    INITPROC = 264,                /* INITPROC  */
+    PUPABLE = 265,                 /* PUPABLE  */
+    CHARE = 266,                   /* CHARE  */
+    MAINCHARE = 267,               /* MAINCHARE  */
+    GROUP = 268,                   /* GROUP  */
+    NODEGROUP = 269,               /* NODEGROUP  */
+    ARRAY = 270,                   /* ARRAY  */
+    MESSAGE = 271,                 /* MESSAGE  */
+    CONDITIONAL = 272,             /* CONDITIONAL  */
+    NOCOPY = 273,                  /* NOCOPY  */
+    NOCOPYPOST = 274,              /* NOCOPYPOST  */
+    CLASS = 275,                   /* CLASS  */
+    INCLUDE = 276,                 /* INCLUDE  */
+    STACKSIZE = 277,               /* STACKSIZE  */
+    THREADED = 278,                /* THREADED  */
+    TEMPLATE = 279,                /* TEMPLATE  */
+    SYNC = 280,                    /* SYNC  */
+    IGET = 281,                    /* IGET  */
+    EXCLUSIVE = 282,               /* EXCLUSIVE  */
+    IMMEDIATE = 283,               /* IMMEDIATE  */
+    SKIPSCHED = 284,               /* SKIPSCHED  */
+    INLINE = 285,                  /* INLINE  */
+    VIRTUAL = 286,                 /* VIRTUAL  */
+    MIGRATABLE = 287,              /* MIGRATABLE  */
+    CREATEHERE = 288,              /* CREATEHERE  */
+    CREATEHOME = 289,              /* CREATEHOME  */
+    NOKEEP = 290,                  /* NOKEEP  */
+    NOTRACE = 291,                 /* NOTRACE  */
+    APPWORK = 292,                 /* APPWORK  */
+    VOID = 293,                    /* VOID  */
+    CONST = 294,                   /* CONST  */
+    PACKED = 295,                  /* PACKED  */
+    VARSIZE = 296,                 /* VARSIZE  */
+    ENTRY = 297,                   /* ENTRY  */
+    FOR = 298,                     /* FOR  */
+    FORALL = 299,                  /* FORALL  */
+    WHILE = 300,                   /* WHILE  */
+    WHEN = 301,                    /* WHEN  */
+    OVERLAP = 302,                 /* OVERLAP  */
+    ATOMIC = 303,                  /* ATOMIC  */
+    IF = 304,                      /* IF  */
+    ELSE = 305,                    /* ELSE  */
+    PYTHON = 306,                  /* PYTHON  */
+    LOCAL = 307,                   /* LOCAL  */
+    NAMESPACE = 308,               /* NAMESPACE  */
+    USING = 309,                   /* USING  */
+    IDENT = 310,                   /* IDENT  */
+    NUMBER = 311,                  /* NUMBER  */
+    LITERAL = 312,                 /* LITERAL  */
+    CPROGRAM = 313,                /* CPROGRAM  */
+    HASHIF = 314,                  /* HASHIF  */
+    HASHIFDEF = 315,               /* HASHIFDEF  */
+    INT = 316,                     /* INT  */
+    LONG = 317,                    /* LONG  */
+    SHORT = 318,                   /* SHORT  */
+    CHAR = 319,                    /* CHAR  */
+    FLOAT = 320,                   /* FLOAT  */
+    DOUBLE = 321,                  /* DOUBLE  */
+    UNSIGNED = 322,                /* UNSIGNED  */
+    ACCEL = 323,                   /* ACCEL  */
+    READWRITE = 324,               /* READWRITE  */
+    WRITEONLY = 325,               /* WRITEONLY  */
+    ACCELBLOCK = 326,              /* ACCELBLOCK  */
+    MEMCRITICAL = 327,             /* MEMCRITICAL  */
+    REDUCTIONTARGET = 328,         /* REDUCTIONTARGET  */
+    CASE = 329                     /* CASE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define MODULE 258
 #define MAINMODULE 259
 #define EXTERN 260
@@ -127,70 +149,68 @@
 #define ARRAY 270
 #define MESSAGE 271
 #define CONDITIONAL 272
-#define CLASS 273
-#define INCLUDE 274
-#define STACKSIZE 275
-#define THREADED 276
-#define TEMPLATE 277
-#define SYNC 278
-#define IGET 279
-#define EXCLUSIVE 280
-#define IMMEDIATE 281
-#define SKIPSCHED 282
-#define INLINE 283
-#define VIRTUAL 284
-#define MIGRATABLE 285
-#define CREATEHERE 286
-#define CREATEHOME 287
-#define NOKEEP 288
-#define NOTRACE 289
-#define APPWORK 290
-#define VOID 291
-#define CONST 292
-#define PACKED 293
-#define VARSIZE 294
-#define ENTRY 295
-#define FOR 296
-#define FORALL 297
-#define WHILE 298
-#define WHEN 299
-#define OVERLAP 300
-#define ATOMIC 301
-#define IF 302
-#define ELSE 303
-#define PYTHON 304
-#define LOCAL 305
-#define NAMESPACE 306
-#define USING 307
-#define IDENT 308
-#define NUMBER 309
-#define LITERAL 310
-#define CPROGRAM 311
-#define HASHIF 312
-#define HASHIFDEF 313
-#define INT 314
-#define LONG 315
-#define SHORT 316
-#define CHAR 317
-#define FLOAT 318
-#define DOUBLE 319
-#define UNSIGNED 320
-#define ACCEL 321
-#define READWRITE 322
-#define WRITEONLY 323
-#define ACCELBLOCK 324
-#define MEMCRITICAL 325
-#define REDUCTIONTARGET 326
-#define CASE 327
-
-
-
+#define NOCOPY 273
+#define NOCOPYPOST 274
+#define CLASS 275
+#define INCLUDE 276
+#define STACKSIZE 277
+#define THREADED 278
+#define TEMPLATE 279
+#define SYNC 280
+#define IGET 281
+#define EXCLUSIVE 282
+#define IMMEDIATE 283
+#define SKIPSCHED 284
+#define INLINE 285
+#define VIRTUAL 286
+#define MIGRATABLE 287
+#define CREATEHERE 288
+#define CREATEHOME 289
+#define NOKEEP 290
+#define NOTRACE 291
+#define APPWORK 292
+#define VOID 293
+#define CONST 294
+#define PACKED 295
+#define VARSIZE 296
+#define ENTRY 297
+#define FOR 298
+#define FORALL 299
+#define WHILE 300
+#define WHEN 301
+#define OVERLAP 302
+#define ATOMIC 303
+#define IF 304
+#define ELSE 305
+#define PYTHON 306
+#define LOCAL 307
+#define NAMESPACE 308
+#define USING 309
+#define IDENT 310
+#define NUMBER 311
+#define LITERAL 312
+#define CPROGRAM 313
+#define HASHIF 314
+#define HASHIFDEF 315
+#define INT 316
+#define LONG 317
+#define SHORT 318
+#define CHAR 319
+#define FLOAT 320
+#define DOUBLE 321
+#define UNSIGNED 322
+#define ACCEL 323
+#define READWRITE 324
+#define WRITEONLY 325
+#define ACCELBLOCK 326
+#define MEMCRITICAL 327
+#define REDUCTIONTARGET 328
+#define CASE 329
 
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+union YYSTYPE
 {
-
-/* Line 1676 of yacc.c  */
 #line 23 "xi-grammar.y"
 
   AstChildren<Module> *modlist;
@@ -230,16 +250,19 @@ typedef union YYSTYPE
   XStr* xstrptr;
   AccelBlock* accelBlock;
 
+#line 254 "y.tab.h"
 
-
-/* Line 1676 of yacc.c  */
-#line 237 "y.tab.h"
-} YYSTYPE;
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
+
 extern YYSTYPE yylval;
 
 
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
@@ -70,6 +70,7 @@ void splitScopedName(const char* name, const char** scope, const char** basename
 %token <intval> CHARE MAINCHARE GROUP NODEGROUP ARRAY
 %token MESSAGE
 %token CONDITIONAL
+%token NOCOPY NOCOPYPOST
 %token CLASS
 %token INCLUDE
 %token STACKSIZE
@@ -904,6 +905,18 @@ Parameter	: Type
 			in_bracket=0;
 			$$ = new Parameter(lineno, $1->getType(), $1->getName() ,$2);
 		} 
+		| NOCOPY ParamBracketStart CCode ']'
+		{ /*Stop grabbing CPROGRAM segments*/
+			in_bracket=0;
+			$$ = new Parameter(lineno, $2->getType(), $2->getName() ,$3);
+			$$->setNocopy();
+		}
+		| NOCOPYPOST ParamBracketStart CCode ']'
+		{ /*Stop grabbing CPROGRAM segments*/
+			in_bracket=0;
+			$$ = new Parameter(lineno, $2->getType(), $2->getName() ,$3);
+			$$->setNocopy(true);
+		}
 		;
 
 AccelBufferType : READONLY  { $$ = Parameter::ACCEL_BUFFER_TYPE_READONLY; }
@@ -341,6 +341,8 @@ public:
     bool declaredReference; // Actually was declared a reference
     int conditional; //If the parameter is conditionally packed
     bool byConst;
+    bool nocopy; //Array sent from the caller's buffer (CkSendBuffer)
+    bool nocopyPost; //...and received into a buffer the callee names first
 
     // DMK - Added field for accelerator options
     int accelBufferType;
@@ -349,6 +351,8 @@ public:
 
     friend class ParamList;
     void pup(XStr &str);
+    void pupSize(XStr &str);
+    void fixedSize(XStr &str);
     void copyPtr(XStr &str);
     void marshallArraySizes(XStr &str);
     void marshallArrayData(XStr &str);
@@ -358,12 +362,16 @@ public:
     void unmarshallArrayDataSDAG(XStr &str);
     void unmarshallArrayDataSDAGCall(XStr &str);
     void pupAllValues(XStr &str);
+    void endUnmarshall(XStr &str);
+    void beginPost(XStr &str);
+    void endPost(XStr &str);
   public:
     Entry *entry;
     Parameter(int Nline,Type *Ntype,const char *Nname=0,
     	const char *NarrLen=0,Value *Nvalue=0);
     void setConditional(int c) { conditional = c; if (c) byReference = false; };
-    void print(XStr &str,int withDefaultValues=0,int useConst=1);
+    void setNocopy(bool post=false) { nocopy = true; nocopyPost = post; }
+    void print(XStr &str,int withDefaultValues=0,int useConst=1,int asSent=0);
     void printAddress(XStr &str);
     void printValue(XStr &str);
     int isMessage(void) const {return type->isMessage();}
@@ -372,6 +380,9 @@ public:
     int isCkMigMsgPtr(void) const {return type->isCkMigMsgPtr();}
     int isArray(void) const {return arrLen!=NULL;}
     int isConditional(void) const {return conditional;}
+    int isFixedSize(void) const;
+    int isNocopy(void) const {return nocopy;}
+    int isNocopyPost(void) const {return nocopyPost;}
     Type *getType(void) {return type;}
     const char *getArrayLen(void) const {return arrLen;}
     const char *getGivenName(void) const {return given_name;}
@@ -422,7 +433,7 @@ class ParamList {
             manyPointers = true;
           }
     }
-    void print(XStr &str,int withDefaultValues=0,int useConst=1);
+    void print(XStr &str,int withDefaultValues=0,int useConst=1,int asSent=0);
     void printAddress(XStr &str);
     void printValue(XStr &str);
     int isNamed(void) const {return param->type->isNamed();}
@@ -471,12 +482,17 @@ class ParamList {
     }
     void preprocess();
     int hasConditional();
-    void marshall(XStr &str, XStr &entry);
+    int hasNocopy();
+    int hasNocopyPost();
+    void marshall(XStr &str, XStr &entry, bool ncpyReference=false);
     void beginUnmarshall(XStr &str);
     void beginUnmarshallSDAG(XStr &str);
     void beginUnmarshallSDAGCall(XStr &str, bool usesImplBuf);
     void beginRednWrapperUnmarshall(XStr &str, bool isSDAGGen);
     void unmarshall(XStr &str, int isFirst=1);
+    void unmarshallPost(XStr &str);
+    void beginPost(XStr &str);
+    void endPost(XStr &str);
     void unmarshallSDAGCall(XStr &str, int isFirst=1);
     void unmarshallAddress(XStr &str, int isFirst=1);
     void pupAllValues(XStr &str);
@@ -773,6 +789,7 @@ class Chare : public TEntity {
     void genIndexNames(XStr& str, const char *prefix, const char *middle, 
                         const char *suffix, const char *sep);
     void printChareNames();
+    int hasMultipleBases(void) const {return bases->length()>1;}
     XStr proxyName(int withTemplates=1); 
     XStr indexName(int withTemplates=1); 
     XStr indexList();
@@ -1015,6 +1032,8 @@ private:
     void genChareDefs(XStr& str);
     
     void genArrayDefs(XStr& str);
+    int isLocalCallable(void);
+    void genLocalCall(XStr& str);
     void genArrayStaticConstructorDecl(XStr& str);
     void genArrayStaticConstructorDefs(XStr& str);
     void genArrayDecl(XStr& str);
@@ -1040,7 +1059,7 @@ private:
     void genAccels_spe_c_regFuncs(XStr& str);
     void genAccels_ppe_c_regFuncs(XStr& str);
 
-    XStr paramType(int withDefaultVals,int withEO=0,int useConst=1);
+    XStr paramType(int withDefaultVals,int withEO=0,int useConst=1,int asSent=1);
     XStr paramComma(int withDefaultVals,int withEO=0);
     XStr eo(int withDefaultVals,int priorComma=1);
     XStr syncReturn(void);